@@ -0,0 +1,321 @@
+#include "Vecteur.h"
+#include "ExecutionAsynchrone.h"
+#include "Matrice.h"
+#include "Noyaux.h"
+#include "RechercheVoisins.h"
+#include "VecteurBatch.h"
+#include "VecteurCompact.h"
+#include "VecteurCreux.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/** \brief Charge de travail reprsentative de l'utilisation de Vecteur: expressions paresseuses, rductions (toutes les stratgies), puissances,
+ * niveau 1 de BLAS, lots, matrices, recherche de voisins (exacte et IVF), stockage compact et creux, politique parallle et pipeline. Les donnes sont
+ * pseudo-alatoires, mais toujours les mmes (graine fixe).
+ *
+ * Elle sert  deux choses (voir CMakeLists.txt):
+ * - l'entranement de l'optimisation guide par profil (PGO): `--iterations` rpte la charge pour accumuler un profil reprsentatif;
+ * - les tests de concordance: chaque rsultat est crit (`--sortie`), puis `--comparer` vrifie que deux variantes (compilation de rfrence et
+ *   compilation optimise, ou deux jeux d'instructions forcs avec `--jeu`) donnent les mmes rsultats.
+ *
+ * Options:
+ *   --iterations <n>       nombre de rptitions de la charge (par dfaut 1)
+ *   --jeu <nom>            force un jeu d'instructions: scalaire, sse2, avx2 ou avx512 (ramen au meilleur jeu support) (voir Noyaux::choisirJeuInstructions)
+ *   --sortie <fichier>     crit les rsultats, un par ligne ( nom valeur ), dans le fichier ("-" pour la sortie standard)
+ *   --comparer <a> <b>     compare deux fichiers de rsultats au lieu d'excuter la charge
+ *   --tolerance <t>        cart relatif permis par `--comparer` (par dfaut 0: identiques bit pour bit)
+ */
+
+namespace
+{
+    struct Resultat
+    {
+        string nom;
+        double valeur;
+    };
+
+    Vecteur aleatoire(const size_t _dimension, mt19937_64 & _generateur){
+        normal_distribution<double> normale;
+        Vecteur retour(_dimension, 0.0);
+        for (size_t i = 0; i < _dimension; i++){
+            retour[i] = normale(_generateur);
+        }
+        return retour;
+    }
+
+    /** \brief Excute la charge une fois et retourne ses rsultats.
+     */
+    vector<Resultat> executerCharge(){
+        vector<Resultat> retour;
+        auto noter = [&retour](const string & _nom, const double _valeur){
+            Resultat resultat = {_nom, _valeur};
+            retour.push_back(resultat);
+        };
+        const size_t n = 100000;
+        mt19937_64 generateur(42);
+        const Vecteur a = aleatoire(n, generateur);
+        const Vecteur b = aleatoire(n, generateur);
+        // Parallle, mais dterministe: le dcoupage ne dpend pas du nombre de fils.
+        const PolitiqueExecution parallele = PolitiqueExecution::parallele(1 << 14, true);
+
+        // Expressions et oprations lment par lment
+        Vecteur c = a + b * 2.0 - a * 0.5;
+        noter("expression.somme", c.somme());
+        c += b;
+        c -= a * 0.25;
+        c *= 1.5;
+        c /= 3.0;
+        c += 0.125;
+        noter("operations.somme", c.somme());
+        Vecteur d(a.getDimension(), 0.0);
+        d.assigner(a * 3.0 + b, parallele);
+        noter("assigner.parallele", d.somme());
+
+        // Rductions
+        noter("dot", a.dot(b));
+        noter("dot.parallele", a.dot(b, parallele));
+        noter("dot.paires", a.dot(b, Noyaux::PAR_PAIRES));
+        noter("dot.compensee", a.dot(b, Noyaux::COMPENSEE));
+        noter("somme", a.somme());
+        noter("somme.parallele", a.somme(parallele));
+        noter("somme.compensee", a.somme(Noyaux::COMPENSEE));
+        noter("norme", a.norme());
+        noter("norme.parallele", a.norme(parallele));
+        noter("norme.compensee", a.norme(Noyaux::COMPENSEE));
+        noter("prod.echelonne", a.prod(Noyaux::COMPENSEE));
+        int signe = 0;
+        noter("logProd", a.logProd(&signe));
+        noter("logProd.signe", signe);
+
+        // Puissances
+        Vecteur positifs = a.exposant(2.0);
+        positifs += 0.5;
+        noter("exposant(1.5)", positifs.exposant(1.5).somme());
+        noter("exposant(0.5)", positifs.exposant(0.5).somme());
+        noter("exposant(-1)", positifs.exposant(-1).somme());
+        noter("exposant(0.7).parallele", positifs.exposant(0.7, parallele).somme());
+
+        // Intervalles
+        noter("intervalle", Vecteur(0.0, 1000.0, 0.1).somme());
+        noter("espaceLineaire", Vecteur::espaceLineaire(-1, 1, 12345).somme());
+
+        // Niveau 1 de BLAS
+        Vecteur y(a);
+        y.axpy(0.75, b);
+        y.axpby(-0.5, a, 2.0);
+        noter("axpy.axpby", y.somme());
+        noter("normaliser", y.normaliser());
+        double normeA, normeB;
+        noter("dotEtNormes", a.dotEtNormes(b, normeA, normeB));
+        noter("dotEtNormes.normeA", normeA);
+        noter("dotEtNormes.normeB", normeB);
+        noter("distance", a.distance(b));
+        noter("distance.parallele", a.distance(b, parallele));
+
+        // Lots et recherche de voisins
+        const size_t dimension = 64;
+        const size_t nombreVecteurs = 2000;
+        VecteurBatch collection(nombreVecteurs, dimension);
+        for (size_t i = 0; i < nombreVecteurs; i++){
+            collection.definir(i, aleatoire(dimension, generateur));
+        }
+        const Vecteur requete = aleatoire(dimension, generateur);
+        noter("batch.dot", collection.dot(requete, parallele).somme());
+        noter("batch.normes", collection.normes().somme());
+        VecteurBatch premieres(64, dimension);
+        for (size_t i = 0; i < 64; i++){
+            premieres.definir(i, collection.extraire(i));
+        }
+        const VecteurBatch gram = premieres.produitsScalaires(premieres);
+        noter("batch.produitsScalaires", gram.extraire(5).somme());
+        const RechercheVoisins::Metrique metriques[3] = {RechercheVoisins::PRODUIT_SCALAIRE, RechercheVoisins::COSINUS, RechercheVoisins::L2};
+        for (size_t m = 0; m < 3; m++){
+            const RechercheVoisins recherche(collection, metriques[m]);
+            const vector<Voisin> voisins = recherche.chercher(requete, 10, parallele);
+            for (size_t i = 0; i < voisins.size(); i++){
+                noter("recherche." + to_string(m) + "." + to_string(i) + ".index", double(voisins[i].index));
+                noter("recherche." + to_string(m) + "." + to_string(i) + ".score", voisins[i].score);
+            }
+        }
+        const IndexIVF index(collection, RechercheVoisins::COSINUS, 16);
+        const vector<Voisin> approximatifs = index.chercher(requete, 10, 4);
+        for (size_t i = 0; i < approximatifs.size(); i++){
+            noter("ivf." + to_string(i) + ".index", double(approximatifs[i].index));
+            noter("ivf." + to_string(i) + ".score", approximatifs[i].score);
+        }
+
+        // Matrices
+        Matrice poids(48, dimension);
+        for (size_t i = 0; i < poids.getNombreLignes(); i++){
+            poids.definirLigne(i, aleatoire(dimension, generateur));
+        }
+        noter("matrice.produit", poids.produit(requete, parallele).somme());
+        noter("matrice.produitTransposee", poids.produitTransposee(poids.colonne(3), parallele).somme());
+        const VecteurBatch sorties = poids.produit(collection, parallele);
+        noter("matrice.produit.lot", sorties.normes().somme());
+        poids.ajouterProduitExterieur(0.25, poids.colonne(0), requete, parallele);
+        noter("matrice.ajouterProduitExterieur", poids.transposee().produit(poids.colonne(1)).somme());
+
+        // Stockage compact et creux
+        noter("compact.float", VecteurFloat(a).dot(VecteurFloat(b)));
+        noter("compact.bfloat16", VecteurBfloat16(a).dot(VecteurBfloat16(b)));
+        noter("compact.int8", VecteurInt8(a).dot(VecteurInt8(b)));
+        vector<size_t> indices;
+        vector<double> valeurs;
+        for (size_t i = 0; i < n; i += 97){
+            indices.push_back(i);
+            valeurs.push_back(a.evaluer(i));
+        }
+        const VecteurCreux creux(n, indices, valeurs);
+        noter("creux.dot", creux.dot(b));
+        noter("creux.norme", creux.norme());
+
+        // Pipeline de petits travaux
+        struct Travail
+        {
+            size_t index;
+            Vecteur v;
+        };
+        vector<double> scores(64);
+        {
+            Pipeline<Travail> pipeline(8);
+            pipeline.ajouterEtape([&](Travail & _travail) { _travail.v = collection.extraire(_travail.index); })
+                    .ajouterEtape([&](Travail & _travail) { _travail.v.normaliser(); scores[_travail.index] = _travail.v.dot(requete); });
+            for (size_t i = 0; i < scores.size(); i++){
+                pipeline.pousser(Travail{i, Vecteur(0, 0.0)});
+            }
+            pipeline.terminer();
+        }
+        noter("pipeline", Vecteur(scores).somme());
+        return retour;
+    }
+
+    bool ecrireResultats(const vector<Resultat> & _resultats, const string & _chemin){
+        FILE * fichier = _chemin == "-" ? stdout : fopen(_chemin.c_str(), "w");
+        if (fichier == nullptr){
+            fprintf(stderr, "impossible d'ecrire %s\n", _chemin.c_str());
+            return false;
+        }
+        for (size_t i = 0; i < _resultats.size(); i++){
+            fprintf(fichier, "%s %.17g\n", _resultats[i].nom.c_str(), _resultats[i].valeur);
+        }
+        if (fichier != stdout){
+            fclose(fichier);
+        }
+        return true;
+    }
+
+    bool lireResultats(const string & _chemin, vector<Resultat> & _resultats){
+        ifstream fichier(_chemin.c_str());
+        if (!fichier){
+            fprintf(stderr, "impossible de lire %s\n", _chemin.c_str());
+            return false;
+        }
+        Resultat resultat;
+        string valeur;
+        while (fichier >> resultat.nom >> valeur){
+            resultat.valeur = strtod(valeur.c_str(), nullptr);
+            _resultats.push_back(resultat);
+        }
+        return true;
+    }
+
+    /** \brief Compare deux fichiers de rsultats. Deux valeurs concordent si |a - b| <= tolrance * max(1, |a|, |b|) (ou si elles sont toutes deux
+     * NaN). Les carts sont affichs.
+     * \return 0 si tout concorde, 1 sinon.
+     */
+    int comparer(const string & _cheminA, const string & _cheminB, const double _tolerance){
+        vector<Resultat> a, b;
+        if (!lireResultats(_cheminA, a) || !lireResultats(_cheminB, b)){
+            return 1;
+        }
+        if (a.empty() || a.size() != b.size()){
+            fprintf(stderr, "nombre de resultats different: %zu et %zu\n", a.size(), b.size());
+            return 1;
+        }
+        size_t ecarts = 0;
+        for (size_t i = 0; i < a.size(); i++){
+            const double x = a[i].valeur;
+            const double y = b[i].valeur;
+            const double echelle = max(1.0, max(fabs(x), fabs(y)));
+            const bool concorde = a[i].nom == b[i].nom && ((std::isnan(x) && std::isnan(y)) || x == y || fabs(x - y) <= _tolerance * echelle);
+            if (!concorde){
+                fprintf(stderr, "ecart: %s = %.17g, %s = %.17g\n", a[i].nom.c_str(), x, b[i].nom.c_str(), y);
+                ecarts++;
+            }
+        }
+        printf("%zu resultats compares, %zu ecart(s) (tolerance %g)\n", a.size(), ecarts, _tolerance);
+        return ecarts == 0 ? 0 : 1;
+    }
+
+    bool lireJeu(const char * _nom, Noyaux::JeuInstructions & _jeu){
+        const Noyaux::JeuInstructions jeux[4] = {Noyaux::SCALAIRE, Noyaux::SSE2, Noyaux::AVX2, Noyaux::AVX512};
+        for (size_t i = 0; i < 4; i++){
+            if (strcmp(_nom, Noyaux::nomJeuInstructions(jeux[i])) == 0){
+                _jeu = jeux[i];
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    size_t iterations = 1;
+    string sortie;
+    double tolerance = 0;
+    string comparerA, comparerB;
+    for (int i = 1; i < argc; i++){
+        const bool valeur = i + 1 < argc;
+        if (strcmp(argv[i], "--iterations") == 0 && valeur){
+            iterations = size_t(strtoull(argv[++i], nullptr, 10));
+        }
+        else if (strcmp(argv[i], "--jeu") == 0 && valeur){
+            Noyaux::JeuInstructions jeu;
+            if (!lireJeu(argv[++i], jeu)){
+                fprintf(stderr, "jeu d'instructions inconnu: %s\n", argv[i]);
+                return 2;
+            }
+            Noyaux::choisirJeuInstructions(jeu);
+        }
+        else if (strcmp(argv[i], "--sortie") == 0 && valeur){
+            sortie = argv[++i];
+        }
+        else if (strcmp(argv[i], "--tolerance") == 0 && valeur){
+            tolerance = strtod(argv[++i], nullptr);
+        }
+        else if (strcmp(argv[i], "--comparer") == 0 && i + 2 < argc){
+            comparerA = argv[++i];
+            comparerB = argv[++i];
+        }
+        else {
+            fprintf(stderr, "usage: %s [--iterations n] [--jeu scalaire|sse2|avx2|avx512] [--sortie fichier] [--comparer a b] [--tolerance t]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (!comparerA.empty()){
+        return comparer(comparerA, comparerB, tolerance);
+    }
+
+    vector<Resultat> resultats;
+    for (size_t i = 0; i < iterations; i++){
+        resultats = executerCharge();
+    }
+    printf("charge representative: %zu iteration(s), %zu resultats, jeu d'instructions: %s\n", iterations, resultats.size(),
+           Noyaux::nomJeuInstructions(Noyaux::jeuInstructions()));
+    if (!sortie.empty() && !ecrireResultats(resultats, sortie)){
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "CompteurAllocations.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+namespace
+{
+    atomic<size_t> allocations(0);
+    atomic<size_t> octets(0);
+
+    void * allouer(const size_t _taille){
+        allocations.fetch_add(1, memory_order_relaxed);
+        octets.fetch_add(_taille, memory_order_relaxed);
+        void * pointeur = malloc(_taille == 0 ? 1 : _taille);
+        if (pointeur == nullptr){
+            throw bad_alloc();
+        }
+        return pointeur;
+    }
+
+    // Version aligne (utilise entre autres par pmr::new_delete_resource et VecteurBatch). On alloue un peu plus, on aligne l'adresse et on garde
+    // le pointeur d'origine juste avant le bloc retourn, pour pouvoir le librer.
+    void * allouerAligne(const size_t _taille, const size_t _alignement){
+        allocations.fetch_add(1, memory_order_relaxed);
+        octets.fetch_add(_taille, memory_order_relaxed);
+        void * brut = malloc(_taille + _alignement + sizeof(void *));
+        if (brut == nullptr){
+            throw bad_alloc();
+        }
+        const uintptr_t adresse = (reinterpret_cast<uintptr_t>(brut) + sizeof(void *) + _alignement - 1) & ~uintptr_t(_alignement - 1);
+        reinterpret_cast<void **>(adresse)[-1] = brut;
+        return reinterpret_cast<void *>(adresse);
+    }
+
+    void libererAligne(void * _pointeur){
+        if (_pointeur != nullptr){
+            free(static_cast<void **>(_pointeur)[-1]);
+        }
+    }
+}
+
+size_t CompteurAllocations::nombreAllocations(){
+    return allocations.load(memory_order_relaxed);
+}
+
+size_t CompteurAllocations::octetsAlloues(){
+    return octets.load(memory_order_relaxed);
+}
+
+// Remplacement des oprateurs globaux. Toutes les autres formes (nothrow, tableaux avec taille, etc.) passent par celles-ci dans libstdc++.
+void * operator new(size_t _taille){
+    return allouer(_taille);
+}
+
+void * operator new[](size_t _taille){
+    return allouer(_taille);
+}
+
+void operator delete(void * _pointeur) noexcept {
+    free(_pointeur);
+}
+
+void operator delete[](void * _pointeur) noexcept {
+    free(_pointeur);
+}
+
+void operator delete(void * _pointeur, size_t) noexcept {
+    free(_pointeur);
+}
+
+void operator delete[](void * _pointeur, size_t) noexcept {
+    free(_pointeur);
+}
+
+void * operator new(size_t _taille, align_val_t _alignement){
+    return allouerAligne(_taille, size_t(_alignement));
+}
+
+void * operator new[](size_t _taille, align_val_t _alignement){
+    return allouerAligne(_taille, size_t(_alignement));
+}
+
+void operator delete(void * _pointeur, align_val_t) noexcept {
+    libererAligne(_pointeur);
+}
+
+void operator delete[](void * _pointeur, align_val_t) noexcept {
+    libererAligne(_pointeur);
+}
+
+void operator delete(void * _pointeur, size_t, align_val_t) noexcept {
+    libererAligne(_pointeur);
+}
+
+void operator delete[](void * _pointeur, size_t, align_val_t) noexcept {
+    libererAligne(_pointeur);
+}
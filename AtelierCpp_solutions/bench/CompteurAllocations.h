@@ -0,0 +1,21 @@
+#ifndef COMPTEURALLOCATIONS_H
+#define COMPTEURALLOCATIONS_H
+
+#include <cstddef>
+
+/** \brief Compteur global des allocations sur le tas, utilis par les benchmarks.
+ * Le fichier CompteurAllocations.cpp remplace les oprateurs globaux `new` et `delete` de l'excutable de benchmark: chaque allocation incrmente
+ * le compteur. a permet de mesurer exactement combien d'allocations fait une opration sur un Vecteur.
+ */
+namespace CompteurAllocations
+{
+    /** \brief Nombre total d'allocations faites depuis le dbut du programme.
+     */
+    size_t nombreAllocations();
+
+    /** \brief Nombre total d'octets allous depuis le dbut du programme.
+     */
+    size_t octetsAlloues();
+}
+
+#endif // COMPTEURALLOCATIONS_H
@@ -0,0 +1,754 @@
+#include "Vecteur.h"
+#include "FichierVecteur.h"
+#include "VecteurCompact.h"
+#include "VecteurCreux.h"
+#include "ExecutionAsynchrone.h"
+#include "Matrice.h"
+#include "Noyaux.h"
+#include "RechercheVoisins.h"
+#include "ReservoirTaches.h"
+#include "InstrumentationVecteur.h"
+#include "CompteurAllocations.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#ifdef __unix__
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/** \brief Suite de benchmarks de la classe Vecteur.
+ * Chaque mthode publique de Vecteur est mesure pour des dimensions allant de 3  `--max` (par dfaut 10^7; 10^8 demande environ 3 Go de
+ * mmoire). Pour chaque mesure, on rapporte le temps par appel, le temps par lment, le dbit mmoire (Go/s, selon le nombre d'octets lus et crits
+ * par l'opration), le nombre d'allocations par appel et le niveau de la hirarchie mmoire dans lequel tient l'opration (L1, L2, L3 ou DRAM).
+ * Le rsultat est affich en tableau et, avec `--json <fichier>`, crit en JSON pour comparer automatiquement deux versions.
+ *
+ * Options:
+ *   --max <n>          dimension maximale (par dfaut 10000000)
+ *   --budget <ms>      dure vise par lot de mesures (par dfaut 20)
+ *   --json <fichier>   crit les rsultats en JSON ("-" pour la sortie standard)
+ *   --filtre <texte>   ne mesure que les oprations dont le nom contient ce texte
+ *   --precision        au lieu des mesures de temps, affiche l'erreur de chaque stratgie de rduction (voir Noyaux::Reduction)
+ *   --instrumentation <fichier>
+ *                       la fin, affiche le rapport d'instrumentation et l'crit en JSON ("-" pour la sortie standard). Il faut compiler avec
+ *                      -DVECTEUR_INSTRUMENTATION (voir InstrumentationVecteur.h); sinon, les compteurs restent  zro.
+ */
+
+namespace
+{
+    volatile double puits = 0; // Empche le compilateur d'liminer les calculs dont on n'utilise pas le rsultat.
+
+    struct Options
+    {
+        size_t dimensionMaximale;
+        double budgetMillisecondes;
+        string fichierJson;
+        string filtre;
+        bool precision;
+        string fichierInstrumentation;
+    };
+
+    struct Resultat
+    {
+        string operation;
+        size_t dimension;
+        size_t repetitions;
+        double nanosecondesParAppel;
+        double allocationsParAppel;
+        double octetsParAppel;
+        string regimeCache;
+    };
+
+    /** \brief Tampon de sortie qui jette tout: sert  mesurer `afficher()` sans crire des mgaoctets dans le terminal.
+     */
+    class TamponNul : public streambuf
+    {
+        protected:
+            int overflow(int _caractere) override { return _caractere == EOF ? 0 : _caractere; }
+            streamsize xsputn(const char *, streamsize _taille) override { return _taille; }
+    };
+
+    struct Caches
+    {
+        size_t l1;
+        size_t l2;
+        size_t l3;
+    };
+
+    /** \brief Tailles des caches de donnes du processeur (valeurs typiques si le systme ne les fournit pas).
+     */
+    Caches detecterCaches(){
+        Caches retour = {32 * 1024, 1024 * 1024, 32 * 1024 * 1024};
+#if defined(__unix__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+        const long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+        const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        const long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (l1 > 0){
+            retour.l1 = size_t(l1);
+        }
+        if (l2 > 0){
+            retour.l2 = size_t(l2);
+        }
+        if (l3 > 0){
+            retour.l3 = size_t(l3);
+        }
+#endif
+        return retour;
+    }
+
+    const char * regimeCache(const double _octets, const Caches & _caches){
+        if (_octets <= _caches.l1){
+            return "L1";
+        }
+        if (_octets <= _caches.l2){
+            return "L2";
+        }
+        if (_octets <= _caches.l3){
+            return "L3";
+        }
+        return "DRAM";
+    }
+
+    /** \brief Mesure une opration. On calibre d'abord le nombre de rptitions pour qu'un lot dure environ `budget` millisecondes, puis on garde
+     * le meilleur de trois lots (le moins perturb par le systme).
+     * \param _preparer: appel avant chaque lot, hors chronomtrage (remet les donnes dans leur tat de dpart).
+     */
+    Resultat mesurer(const string & _nom, const size_t _dimension, const double _octetsParAppel, const Options & _options,
+                     const Caches & _caches, const function<void()> & _operation, const function<void()> & _preparer = function<void()>()){
+        if (_preparer){
+            _preparer();
+        }
+        // Rchauffement et calibration: on double le nombre d'appels jusqu' atteindre un dixime du budget.
+        const double budget = _options.budgetMillisecondes * 1e6;
+        size_t appels = 1;
+        double dureeUnAppel = 0;
+        chrono::steady_clock::time_point debut;
+        while (true){
+            debut = chrono::steady_clock::now();
+            for (size_t i = 0; i < appels; i++){
+                _operation();
+            }
+            const double duree = chrono::duration<double, nano>(chrono::steady_clock::now() - debut).count();
+            dureeUnAppel = duree / appels;
+            if (duree >= budget / 10 || appels >= 1000000){
+                break;
+            }
+            appels *= 2;
+        }
+        size_t repetitions = dureeUnAppel > 0 ? size_t(budget / dureeUnAppel) : 1000000;
+        repetitions = max<size_t>(1, min<size_t>(repetitions, 10000000));
+
+        Resultat retour;
+        retour.operation = _nom;
+        retour.dimension = _dimension;
+        retour.repetitions = repetitions;
+        retour.nanosecondesParAppel = 1e300;
+        retour.allocationsParAppel = 0;
+        retour.octetsParAppel = _octetsParAppel;
+        retour.regimeCache = regimeCache(_octetsParAppel, _caches);
+        const size_t nombreLots = dureeUnAppel * repetitions > 1e9 ? 1 : 3;
+        for (size_t lot = 0; lot < nombreLots; lot++){
+            if (_preparer){
+                _preparer();
+            }
+            const size_t allocationsAvant = CompteurAllocations::nombreAllocations();
+            debut = chrono::steady_clock::now();
+            for (size_t i = 0; i < repetitions; i++){
+                _operation();
+            }
+            const double duree = chrono::duration<double, nano>(chrono::steady_clock::now() - debut).count();
+            retour.allocationsParAppel = double(CompteurAllocations::nombreAllocations() - allocationsAvant) / repetitions;
+            retour.nanosecondesParAppel = min(retour.nanosecondesParAppel, duree / repetitions);
+        }
+        return retour;
+    }
+
+    void afficherEntete(){
+        printf("%-34s %11s %9s %13s %9s %8s %9s %6s\n", "operation", "dimension", "repet.", "ns/appel", "ns/elem", "Go/s", "alloc/op", "cache");
+    }
+
+    void afficherResultat(const Resultat & _resultat){
+        const double goParSeconde = _resultat.octetsParAppel / _resultat.nanosecondesParAppel;
+        printf("%-34s %11zu %9zu %13.1f %9.3f %8.2f %9.2f %6s\n", _resultat.operation.c_str(), _resultat.dimension, _resultat.repetitions,
+               _resultat.nanosecondesParAppel, _resultat.nanosecondesParAppel / _resultat.dimension, goParSeconde,
+               _resultat.allocationsParAppel, _resultat.regimeCache.c_str());
+        fflush(stdout);
+    }
+
+    void ecrireJson(const vector<Resultat> & _resultats, const Options & _options, const Caches & _caches){
+        FILE * fichier = _options.fichierJson == "-" ? stdout : fopen(_options.fichierJson.c_str(), "w");
+        if (fichier == nullptr){
+            fprintf(stderr, "Impossible d'ouvrir %s\n", _options.fichierJson.c_str());
+            return;
+        }
+        fprintf(fichier, "{\n  \"metadonnees\": {\"jeu_instructions\": \"%s\", \"fils\": %zu, \"cache_l1\": %zu, \"cache_l2\": %zu, \"cache_l3\": %zu},\n",
+                Noyaux::nomJeuInstructions(Noyaux::jeuInstructions()), ReservoirTaches::global().getNombreTravailleurs() + 1,
+                _caches.l1, _caches.l2, _caches.l3);
+        fprintf(fichier, "  \"resultats\": [\n");
+        for (size_t i = 0; i < _resultats.size(); i++){
+            const Resultat & r = _resultats[i];
+            fprintf(fichier, "    {\"operation\": \"%s\", \"dimension\": %zu, \"repetitions\": %zu, \"ns_par_appel\": %.3f, \"ns_par_element\": %.6f, "
+                    "\"go_par_s\": %.4f, \"allocations_par_appel\": %.3f, \"octets_par_appel\": %.0f, \"regime_cache\": \"%s\"}%s\n",
+                    r.operation.c_str(), r.dimension, r.repetitions, r.nanosecondesParAppel, r.nanosecondesParAppel / r.dimension,
+                    r.octetsParAppel / r.nanosecondesParAppel, r.allocationsParAppel, r.octetsParAppel, r.regimeCache.c_str(),
+                    i + 1 < _resultats.size() ? "," : "");
+        }
+        fprintf(fichier, "  ]\n}\n");
+        if (fichier != stdout){
+            fclose(fichier);
+        }
+    }
+
+    Options lireOptions(const int _argc, char ** _argv){
+        Options retour;
+        retour.dimensionMaximale = 10000000;
+        retour.budgetMillisecondes = 20;
+        retour.precision = false;
+        for (int i = 1; i < _argc; i++){
+            const bool valeur = i + 1 < _argc;
+            if (strcmp(_argv[i], "--max") == 0 && valeur){
+                retour.dimensionMaximale = size_t(atof(_argv[++i]));
+            }
+            else if (strcmp(_argv[i], "--budget") == 0 && valeur){
+                retour.budgetMillisecondes = atof(_argv[++i]);
+            }
+            else if (strcmp(_argv[i], "--json") == 0 && valeur){
+                retour.fichierJson = _argv[++i];
+            }
+            else if (strcmp(_argv[i], "--filtre") == 0 && valeur){
+                retour.filtre = _argv[++i];
+            }
+            else if (strcmp(_argv[i], "--precision") == 0){
+                retour.precision = true;
+            }
+            else if (strcmp(_argv[i], "--instrumentation") == 0 && valeur){
+                retour.fichierInstrumentation = _argv[++i];
+            }
+            else {
+                fprintf(stderr, "usage: %s [--max n] [--budget ms] [--json fichier] [--filtre texte] [--precision] [--instrumentation fichier]\n", _argv[0]);
+                exit(1);
+            }
+        }
+        return retour;
+    }
+
+    /** \brief Somme exacte, arrondie une seule fois  la fin (algorithme de Shewchuk, comme `math.fsum` en Python): on garde une liste de sommes
+     * partielles sans chevauchement dont le total reprsente exactement la somme des termes vus. Sert de rfrence  l'analyse de prcision.
+     */
+    double sommeExacte(const vector<double> & _termes){
+        vector<double> partielles;
+        for (size_t i = 0; i < _termes.size(); i++){
+            double x = _termes[i];
+            size_t nombre = 0;
+            for (size_t j = 0; j < partielles.size(); j++){
+                double y = partielles[j];
+                if (fabs(x) < fabs(y)){
+                    swap(x, y);
+                }
+                const double haut = x + y;
+                const double bas = y - (haut - x);
+                if (bas != 0){
+                    partielles[nombre++] = bas;
+                }
+                x = haut;
+            }
+            partielles.resize(nombre);
+            partielles.push_back(x);
+        }
+        double retour = 0;
+        for (size_t j = 0; j < partielles.size(); j++){
+            retour += partielles[j];
+        }
+        return retour;
+    }
+
+    double erreurRelative(const double _valeur, const double _reference){
+        return _reference == 0 ? fabs(_valeur) : fabs(_valeur - _reference) / fabs(_reference);
+    }
+
+    /** \brief Affiche l'erreur relative de chaque stratgie de rduction (voir Noyaux::Reduction) sur des donnes de plus en plus mal
+     * conditionnes, par rapport  la somme exacte. Le conditionnement est somme(|x_i|) / |somme(x_i)|: l'erreur relative attendue est de
+     * l'ordre de (nombre d'additions en chane) * u * conditionnement pour les stratgies non compenses, et de u pour COMPENSEE tant que le
+     * conditionnement reste sous 1 / (n * u).
+     */
+    void analyserPrecision(const Options & _options){
+        const size_t n = min(_options.dimensionMaximale, size_t(1000000));
+        mt19937_64 generateur(42);
+        normal_distribution<double> normale;
+        uniform_real_distribution<double> uniforme(0, 1);
+        uniform_int_distribution<int> exposants(0, 40);
+
+        struct Donnees
+        {
+            string nom;
+            vector<double> a;
+            vector<double> b;
+        };
+        vector<Donnees> jeux(3);
+        jeux[0].nom = "positifs [0, 1)";
+        jeux[1].nom = "normaux N(0, 1)";
+        jeux[2].nom = "annulations (x, -x)";
+        for (size_t i = 0; i < n; i++){
+            jeux[0].a.push_back(uniforme(generateur));
+            jeux[0].b.push_back(uniforme(generateur));
+            jeux[1].a.push_back(normale(generateur));
+            jeux[1].b.push_back(normale(generateur));
+        }
+        // Paires presque opposes d'amplitudes trs varies: la somme est minuscule devant les termes.
+        while (jeux[2].a.size() < n){
+            const double x = normale(generateur) * ldexp(1.0, exposants(generateur));
+            jeux[2].a.push_back(x);
+            jeux[2].a.push_back(-x * (1 + 1e-6 * normale(generateur)));
+        }
+        jeux[2].a.resize(n);
+        shuffle(jeux[2].a.begin(), jeux[2].a.end(), generateur);
+        for (size_t i = 0; i < n; i++){
+            jeux[2].b.push_back(1 + 1e-3 * normale(generateur));
+        }
+
+        printf("\nerreur relative des reductions, n = %zu (jeu d'instructions: %s, u = 1.1e-16)\n", n,
+               Noyaux::nomJeuInstructions(Noyaux::jeuInstructions()));
+        printf("%-10s %-22s %10s %10s %10s %10s %10s\n", "operation", "donnees", "condition.", "ancien", "rapide", "paires", "compensee");
+        for (size_t j = 0; j < jeux.size(); j++){
+            Vecteur a(jeux[j].a);
+            Vecteur b(jeux[j].b);
+            vector<double> absolus(n), termes, termesAbsolus;
+            for (size_t i = 0; i < n; i++){
+                absolus[i] = fabs(jeux[j].a[i]);
+                // a * b = terme + erreur exactement (FMA): la somme exacte de ces 2n nombres est le produit scalaire exact.
+                const double terme = jeux[j].a[i] * jeux[j].b[i];
+                termes.push_back(terme);
+                termes.push_back(fma(jeux[j].a[i], jeux[j].b[i], -terme));
+                termesAbsolus.push_back(fabs(terme));
+            }
+
+            double ancien = 0;
+            for (size_t i = 0; i < n; i++){
+                ancien += jeux[j].a[i];
+            }
+            double reference = sommeExacte(jeux[j].a);
+            printf("%-10s %-22s %10.1e %10.1e %10.1e %10.1e %10.1e\n", "somme", jeux[j].nom.c_str(), sommeExacte(absolus) / fabs(reference),
+                   erreurRelative(ancien, reference), erreurRelative(a.somme(Noyaux::RAPIDE), reference),
+                   erreurRelative(a.somme(Noyaux::PAR_PAIRES), reference), erreurRelative(a.somme(Noyaux::COMPENSEE), reference));
+
+            ancien = 0;
+            for (size_t i = 0; i < n; i++){
+                ancien += jeux[j].a[i] * jeux[j].b[i];
+            }
+            reference = sommeExacte(termes);
+            printf("%-10s %-22s %10.1e %10.1e %10.1e %10.1e %10.1e\n", "dot", jeux[j].nom.c_str(), sommeExacte(termesAbsolus) / fabs(reference),
+                   erreurRelative(ancien, reference), erreurRelative(a.dot(b, Noyaux::RAPIDE), reference),
+                   erreurRelative(a.dot(b, Noyaux::PAR_PAIRES), reference), erreurRelative(a.dot(b, Noyaux::COMPENSEE), reference));
+        }
+
+        // Produit de n valeurs log-normales: le produit final et les produits intermdiaires dpassent largement les limites des doubles.
+        vector<double> facteurs(n), logarithmes(n);
+        for (size_t i = 0; i < n; i++){
+            facteurs[i] = exp(3 * normale(generateur));
+            logarithmes[i] = log(facteurs[i]);
+        }
+        Vecteur produit(facteurs);
+        const double referenceLog = sommeExacte(logarithmes);
+        printf("\nprod de %zu facteurs exp(3 N(0, 1)): log exact ~ %.6g\n", n, referenceLog);
+        printf("  prod() = %g, prod(echelonne) = %g, erreur relative de logProd() = %.1e\n", produit.prod(), produit.prod(Noyaux::COMPENSEE),
+               erreurRelative(produit.logProd(), referenceLog));
+    }
+
+    /** \brief Mesure toutes les mthodes publiques de Vecteur pour une dimension donne.
+     */
+    void benchmarkDimension(const size_t _n, const Options & _options, const Caches & _caches, vector<Resultat> & _resultats){
+        const double n = double(_n);
+        const double d = sizeof(double);
+        vector<double> valeurs(_n, 1.0);
+        Vecteur a(_n, 1.0);
+        Vecteur b(_n, 1e-9);
+        Vecteur c(_n, 0.0);
+        const PolitiqueExecution parallele = PolitiqueExecution::parallele();
+
+        auto ajouter = [&](const string & _nom, const double _octets, const function<void()> & _operation, const function<void()> & _preparer){
+            if (!_options.filtre.empty() && _nom.find(_options.filtre) == string::npos){
+                return;
+            }
+            _resultats.push_back(mesurer(_nom, _n, _octets, _options, _caches, _operation, _preparer));
+            afficherResultat(_resultats.back());
+        };
+        const function<void()> rien;
+
+        // Constructeurs, destructeur et assignations
+        ajouter("Vecteur(dimension, valeur)", n * d, [&]() { Vecteur v(_n, 2.0); puits = puits + v.evaluer(0); }, rien);
+        ajouter("Vecteur(vector<double>)", 2 * n * d, [&]() { Vecteur v(valeurs); puits = puits + v.evaluer(0); }, rien);
+        ajouter("ancien: Vecteur(debut, fin, pas) (push_back + copie)", 3 * n * d, [&]() {
+            vector<double> interne;
+            for (double x = 0; x < n; x += 1.0){
+                interne.push_back(x);
+            }
+            Vecteur v(interne);
+            puits = puits + v.evaluer(0);
+        }, rien);
+        ajouter("Vecteur(debut, fin, pas)", n * d, [&]() { Vecteur v(0.0, n, 1.0); puits = puits + v.evaluer(0); }, rien);
+        ajouter("Vecteur(debut, fin, pas)[parallele]", n * d, [&]() { Vecteur v(0.0, n, 1.0, parallele); puits = puits + v.evaluer(0); }, rien);
+        ajouter("Vecteur::espaceLineaire", n * d, [&]() { Vecteur v = Vecteur::espaceLineaire(0, 1, _n); puits = puits + v.evaluer(0); }, rien);
+        ajouter("ExpressionIntervalle.dot(a) (paresseux)", n * d, [&]() { puits = puits + ExpressionIntervalle(0.0, n, 1.0).dot(a); }, rien);
+        ajouter("Vecteur(const Vecteur &)", 2 * n * d, [&]() { Vecteur v(a); puits = puits + v.evaluer(0); }, rien);
+        ajouter("Vecteur(Vecteur &&)", 2 * n * d, [&]() { Vecteur v(a); Vecteur w(move(v)); puits = puits + w.evaluer(0); }, rien);
+        ajouter("Vecteur(expression a+b*s)", 3 * n * d, [&]() { Vecteur v = a + b * 2.0; puits = puits + v.evaluer(0); }, rien);
+        ajouter("operator=(const Vecteur &)", 2 * n * d, [&]() { c = a; }, rien);
+        ajouter("operator=(Vecteur &&)", 2 * n * d, [&]() { c = Vecteur(a); }, rien);
+        ajouter("operator=(expression a+b*s-a)", 3 * n * d, [&]() { c = a + b * 2.0 - a; }, rien);
+        ajouter("operator[] (parcours)", n * d, [&]() {
+            double s = 0;
+            for (size_t i = 0; i < _n; i++){
+                s += a[i];
+            }
+            puits = puits + s;
+        }, rien);
+        ajouter("at (parcours, toujours verifie)", n * d, [&]() {
+            double s = 0;
+            for (size_t i = 0; i < _n; i++){
+                s += a.at(i);
+            }
+            puits = puits + s;
+        }, rien);
+        ajouter("operator[] (ecriture c[i] = a[i] + b[i])", 3 * n * d, [&]() {
+            for (size_t i = 0; i < _n; i++){
+                c[i] = a[i] + b[i];
+            }
+        }, rien);
+        ajouter("transform(begin, end) (c = a + b)", 3 * n * d, [&]() { transform(a.begin(), a.end(), b.begin(), c.begin(), plus<double>()); }, rien);
+
+        // Mathmatiques vecteur avec vecteur
+        ajouter("operator+=(Vecteur)", 3 * n * d, [&]() { c += b; }, [&]() { c = a; });
+        ajouter("operator-=(Vecteur)", 3 * n * d, [&]() { c -= b; }, [&]() { c = a; });
+        ajouter("operator+=(expression b*s)", 3 * n * d, [&]() { c += b * 0.5; }, [&]() { c = a; });
+        ajouter("operator*(Vecteur) (dot)", 2 * n * d, [&]() { puits = puits + a * b; }, rien);
+        ajouter("ancien: c = Vecteur(c + b)", 5 * n * d, [&]() { Vecteur retour = c + b; c = retour; }, [&]() { c = a; });
+
+        // Mathmatiques vecteur avec scalaire
+        ajouter("operator+=(double)", 2 * n * d, [&]() { c += 1e-9; }, [&]() { c = a; });
+        ajouter("operator-=(double)", 2 * n * d, [&]() { c -= 1e-9; }, [&]() { c = a; });
+        ajouter("operator*=(double)", 2 * n * d, [&]() { c *= 1.0000001; }, [&]() { c = a; });
+        ajouter("operator/=(double)", 2 * n * d, [&]() { c /= 1.0000001; }, [&]() { c = a; });
+
+        // Mathmatiques autres
+        ajouter("dot", 2 * n * d, [&]() { puits = puits + a.dot(b); }, rien);
+        ajouter("dot(vue)", 2 * n * d, [&]() { puits = puits + a.dot(b.vue()); }, rien);
+        ajouter("tranche(0, n, 2).somme", n * d, [&]() { puits = puits + a.tranche(0, _n, 2).somme(); }, rien);
+        ajouter("dot[parallele]", 2 * n * d, [&]() { puits = puits + a.dot(b, parallele); }, rien);
+        if (_n == 3){
+            ajouter("cross", 3 * n * d, [&]() { Vecteur v = a.cross(b); puits = puits + v.evaluer(0); }, rien);
+        }
+        ajouter("exposant(1.5)", 2 * n * d, [&]() { Vecteur v = a.exposant(1.5); puits = puits + v.evaluer(0); }, rien);
+        ajouter("exposant(1.5)[parallele]", 2 * n * d, [&]() { Vecteur v = a.exposant(1.5, parallele); puits = puits + v.evaluer(0); }, rien);
+        // Puissances sur des valeurs varies (pow a un raccourci pour x = 1)
+        Vecteur positifs(_n, 0.0);
+        for (size_t i = 0; i < _n; i++){
+            positifs[i] = 0.5 + double(i % 1000) / 7.0;
+        }
+        ajouter("ancien: exposant(0.7) (copie + pow)", 3 * n * d, [&]() {
+            Vecteur v(positifs);
+            for (size_t i = 0; i < _n; i++){
+                v[i] = pow(positifs.evaluer(i), 0.7);
+            }
+            puits = puits + v.evaluer(0);
+        }, rien);
+        ajouter("exposant(0.7)", 2 * n * d, [&]() { Vecteur v = positifs.exposant(0.7); puits = puits + v.evaluer(0); }, rien);
+        ajouter("exposant(2)", 2 * n * d, [&]() { Vecteur v = positifs.exposant(2); puits = puits + v.evaluer(0); }, rien);
+        ajouter("exposant(0.5)", 2 * n * d, [&]() { Vecteur v = positifs.exposant(0.5); puits = puits + v.evaluer(0); }, rien);
+        ajouter("exposantEnPlace(0.7)", 2 * n * d, [&]() { c.exposantEnPlace(0.7); }, [&]() { c = positifs; });
+        ajouter("exposantEnPlace(-1)", 2 * n * d, [&]() { c.exposantEnPlace(-1); }, [&]() { c = positifs; });
+        ajouter("somme", n * d, [&]() { puits = puits + a.somme(); }, rien);
+        ajouter("somme[parallele]", n * d, [&]() { puits = puits + a.somme(parallele); }, rien);
+        ajouter("prod", n * d, [&]() { puits = puits + a.prod(); }, rien);
+        ajouter("norme", n * d, [&]() { puits = puits + a.norme(); }, rien);
+        ajouter("norme[parallele]", n * d, [&]() { puits = puits + a.norme(parallele); }, rien);
+        ajouter("assigner(a+b*s)[parallele]", 3 * n * d, [&]() { c.assigner(a + b * 2.0, parallele); }, rien);
+
+        // Stratgies de rduction (voir Noyaux::Reduction), compares  l'ancienne boucle  une seule somme
+        ajouter("ancien: somme (un accumulateur)", n * d, [&]() {
+            const double * donnees = a.tranche(0, _n).getDonnees();
+            double retour = 0;
+            for (size_t i = 0; i < _n; i++){
+                retour += donnees[i];
+            }
+            puits = puits + retour;
+        }, rien);
+        ajouter("somme[paires]", n * d, [&]() { puits = puits + a.somme(Noyaux::PAR_PAIRES); }, rien);
+        ajouter("somme[compensee]", n * d, [&]() { puits = puits + a.somme(Noyaux::COMPENSEE); }, rien);
+        ajouter("dot[paires]", 2 * n * d, [&]() { puits = puits + a.dot(b, Noyaux::PAR_PAIRES); }, rien);
+        ajouter("dot[compensee]", 2 * n * d, [&]() { puits = puits + a.dot(b, Noyaux::COMPENSEE); }, rien);
+        ajouter("norme[compensee]", n * d, [&]() { puits = puits + a.norme(Noyaux::COMPENSEE); }, rien);
+        ajouter("prod[echelonne]", n * d, [&]() { puits = puits + a.prod(Noyaux::COMPENSEE); }, rien);
+        ajouter("logProd", n * d, [&]() { puits = puits + a.logProd(); }, rien);
+
+        // Niveau 1 de BLAS (FMA, un seul passage), compar aux mmes calculs crits avec les oprateurs
+        ajouter("ancien: c = c + b * s (temporaire)", 5 * n * d, [&]() { Vecteur retour = c + b * 0.5; c = retour; }, [&]() { c = a; });
+        ajouter("axpy", 3 * n * d, [&]() { c.axpy(0.5, b); }, [&]() { c = a; });
+        ajouter("axpy[parallele]", 3 * n * d, [&]() { c.axpy(0.5, b, parallele); }, [&]() { c = a; });
+        ajouter("ancien: c *= s; c += b * s", 5 * n * d, [&]() { c *= 0.9; c += b * 0.1; }, [&]() { c = a; });
+        ajouter("axpby", 3 * n * d, [&]() { c.axpby(0.1, b, 0.9); }, [&]() { c = a; });
+        ajouter("ancien: c = c / c.norme()", 3 * n * d, [&]() { Vecteur retour = c / c.norme(); c = retour; }, [&]() { c = a; });
+        ajouter("normaliser", 3 * n * d, [&]() { puits = puits + c.normaliser(); }, [&]() { c = a; });
+        ajouter("ancien: dot + 2 normes", 4 * n * d, [&]() { puits = puits + a.dot(b) / (a.norme() * b.norme()); }, rien);
+        ajouter("dotEtNormes", 2 * n * d, [&]() {
+            double normeA, normeB;
+            const double produit = a.dotEtNormes(b, normeA, normeB);
+            puits = puits + produit / (normeA * normeB);
+        }, rien);
+        ajouter("ancien: Vecteur(a - b).norme()", 5 * n * d, [&]() { Vecteur difference = a - b; puits = puits + difference.norme(); }, rien);
+        ajouter("distance", 2 * n * d, [&]() { puits = puits + a.distance(b); }, rien);
+        ajouter("distance[parallele]", 2 * n * d, [&]() { puits = puits + a.distance(b, parallele); }, rien);
+
+        // Recherche des 10 plus proches voisins (voir RechercheVoisins.h) dans _n / 64 vecteurs de dimension 64: on lit les _n lments.
+        if (_n >= 10000){
+            const size_t dimensionRecherche = 64;
+            const size_t nombreVecteurs = _n / dimensionRecherche;
+            mt19937_64 generateur(7);
+            normal_distribution<double> normale;
+            VecteurBatch collection(nombreVecteurs, dimensionRecherche);
+            vector<Vecteur> collectionSeparee;
+            for (size_t i = 0; i < nombreVecteurs; i++){
+                for (size_t j = 0; j < dimensionRecherche; j++){
+                    collection(i, j) = normale(generateur);
+                }
+                collectionSeparee.push_back(collection.extraire(i));
+            }
+            const Vecteur requete = collection.extraire(nombreVecteurs / 2);
+            ajouter("ancien: top-10 cosinus (dot + norme + tri)", n * d, [&]() {
+                vector<pair<double, size_t> > scores(nombreVecteurs);
+                for (size_t i = 0; i < nombreVecteurs; i++){
+                    scores[i] = make_pair(-requete.dot(collectionSeparee[i]) / (requete.norme() * collectionSeparee[i].norme()), i);
+                }
+                sort(scores.begin(), scores.end());
+                puits = puits + scores[0].first;
+            }, rien);
+            const RechercheVoisins cosinus(collection, RechercheVoisins::COSINUS);
+            const RechercheVoisins l2(collection, RechercheVoisins::L2);
+            ajouter("RechercheVoisins top-10 cosinus", n * d, [&]() { puits = puits + cosinus.chercher(requete, 10)[0].score; }, rien);
+            ajouter("RechercheVoisins top-10 cosinus[parallele]", n * d, [&]() {
+                puits = puits + cosinus.chercher(requete, 10, parallele)[0].score;
+            }, rien);
+            ajouter("RechercheVoisins top-10 L2", n * d, [&]() { puits = puits + l2.chercher(requete, 10)[0].score; }, rien);
+            VecteurBatch requetes(64, dimensionRecherche);
+            for (size_t i = 0; i < requetes.getNombreLignes(); i++){
+                requetes.definir(i, collection.extraire(i * (nombreVecteurs / requetes.getNombreLignes())));
+            }
+            ajouter("RechercheVoisins top-10 cosinus x64 (une requete a la fois)", 64 * n * d, [&]() {
+                for (size_t i = 0; i < requetes.getNombreLignes(); i++){
+                    puits = puits + cosinus.chercher(Vecteur(requetes.vueLigne(i)), 10)[0].score;
+                }
+            }, rien);
+            ajouter("RechercheVoisins top-10 cosinus x64 (par tuiles)", 64 * n * d, [&]() {
+                puits = puits + cosinus.chercher(requetes, 10)[0][0].score;
+            }, rien);
+            // L'index n'est construit que si la mesure n'est pas filtre (l'entranement prend du temps).
+            unique_ptr<IndexIVF> index;
+            const size_t nombreListes = size_t(sqrt(double(nombreVecteurs)));
+            ajouter("IndexIVF top-10 cosinus (sqrt(N) listes, 4 sondes)", n * d, [&]() {
+                puits = puits + index->chercher(requete, 10, 4)[0].score;
+            }, [&]() {
+                if (!index){
+                    index.reset(new IndexIVF(collection, RechercheVoisins::COSINUS, nombreListes, 10, 1, parallele));
+                }
+            });
+        }
+
+        // Produits matrice-vecteur (voir Matrice.h), compars  la boucle de `dot` sur les lignes. La matrice a _n / 256 lignes de 256 colonnes:
+        // on lit les _n lments. Le modle linaire applique des poids de 64 x 256 (128 Ko, dans la cache L2)  _n / 256 vecteurs.
+        if (_n >= 1024){
+            const size_t colonnes = 256;
+            const size_t nombreLignes = _n / colonnes;
+            mt19937_64 generateur(11);
+            normal_distribution<double> normale;
+            Matrice matrice(nombreLignes, colonnes);
+            vector<Vecteur> lignesSeparees;
+            for (size_t i = 0; i < nombreLignes; i++){
+                for (size_t j = 0; j < colonnes; j++){
+                    matrice(i, j) = normale(generateur);
+                }
+                lignesSeparees.push_back(matrice.ligne(i));
+            }
+            const Vecteur x = matrice.ligne(0);
+            const Vecteur poidsLignes = matrice.colonne(0);
+            ajouter("ancien: A x (dot par ligne)", n * d, [&]() {
+                Vecteur y(nombreLignes, 0.0);
+                for (size_t i = 0; i < nombreLignes; i++){
+                    y[i] = lignesSeparees[i].dot(x);
+                }
+                puits = puits + y[0];
+            }, rien);
+            ajouter("Matrice::produit (A x)", n * d, [&]() { puits = puits + matrice.produit(x)[0]; }, rien);
+            ajouter("Matrice::produit (A x)[parallele]", n * d, [&]() { puits = puits + matrice.produit(x, parallele)[0]; }, rien);
+            ajouter("ancien: x A (y += ligne * x_i)", n * d, [&]() {
+                Vecteur y(colonnes, 0.0);
+                for (size_t i = 0; i < nombreLignes; i++){
+                    y += lignesSeparees[i] * poidsLignes.evaluer(i);
+                }
+                puits = puits + y[0];
+            }, rien);
+            ajouter("Matrice::produitTransposee (x A)", n * d, [&]() { puits = puits + matrice.produitTransposee(poidsLignes)[0]; }, rien);
+            ajouter("Matrice::produitTransposee (x A)[parallele]", n * d, [&]() {
+                puits = puits + matrice.produitTransposee(poidsLignes, parallele)[0];
+            }, rien);
+            ajouter("Matrice::ajouterProduitExterieur (A += a u v^T)", 2 * n * d, [&]() {
+                matrice.ajouterProduitExterieur(1e-9, poidsLignes, x);
+            }, rien);
+
+            const size_t sorties = 64;
+            Matrice poids(sorties, colonnes);
+            vector<Vecteur> poidsSepares;
+            for (size_t i = 0; i < sorties; i++){
+                for (size_t j = 0; j < colonnes; j++){
+                    poids(i, j) = normale(generateur) / 16;
+                }
+                poidsSepares.push_back(poids.ligne(i));
+            }
+            const VecteurBatch & entrees = matrice.getLignes();
+            ajouter("ancien: modele lineaire 64x256 (dot par ligne, par vecteur)", n * d, [&]() {
+                Vecteur y(sorties, 0.0);
+                for (size_t k = 0; k < nombreLignes; k++){
+                    const Vecteur entree(entrees.vueLigne(k));
+                    for (size_t i = 0; i < sorties; i++){
+                        y[i] = poidsSepares[i].dot(entree);
+                    }
+                    puits = puits + y[0];
+                }
+            }, rien);
+            ajouter("Matrice::produit (modele lineaire 64x256, lot)", n * d, [&]() { puits = puits + poids.produit(entrees)(0, 0); }, rien);
+            ajouter("Matrice::produit (modele lineaire 64x256, lot)[parallele]", n * d, [&]() {
+                puits = puits + poids.produit(entrees, parallele)(0, 0);
+            }, rien);
+        }
+
+        // Vecteur creux  1 % de non-nuls (voir VecteurCreux.h), compar aux mmes calculs en dense
+        if (_n >= 100){
+            vector<size_t> indices;
+            vector<double> valeursCreuses;
+            for (size_t i = 0; i < _n; i += 100){
+                indices.push_back(i);
+                valeursCreuses.push_back(0.5);
+            }
+            const VecteurCreux creux(_n, indices, valeursCreuses);
+            const Vecteur creuxDense = creux.versDense();
+            const double k = double(indices.size());
+            ajouter("VecteurCreux(1%).dot(dense)", k * (2 * sizeof(size_t) + d), [&]() { puits = puits + creux.dot(a); }, rien);
+            ajouter("dense(1% non-nuls).dot(dense)", 2 * n * d, [&]() { puits = puits + creuxDense.vue().dot(a.vue()); }, rien);
+            ajouter("VecteurCreux(1%).norme", k * d, [&]() { puits = puits + creux.norme(); }, rien);
+            ajouter("dense + VecteurCreux(1%)", 2 * n * d, [&]() { Vecteur v = a + creux; puits = puits + v.evaluer(0); }, rien);
+        }
+
+        // Stockage compact (voir VecteurCompact.h): mme produit scalaire, 2  8 fois moins d'octets lus
+        const VecteurFloat aFloat(a), bFloat(b);
+        const VecteurBfloat16 aBfloat16(a), bBfloat16(b);
+        const VecteurInt8 aInt8(a), bInt8(b);
+        ajouter("VecteurFloat.dot", 2 * n * sizeof(float), [&]() { puits = puits + aFloat.dot(bFloat); }, rien);
+        ajouter("VecteurBfloat16.dot", 2 * n * sizeof(Bfloat16), [&]() { puits = puits + aBfloat16.dot(bBfloat16); }, rien);
+        ajouter("VecteurInt8.dot", 2 * n * sizeof(int8_t), [&]() { puits = puits + aInt8.dot(bInt8); }, rien);
+        ajouter("VecteurFloat(Vecteur)", n * (d + sizeof(float)), [&]() { VecteurFloat v(a); puits = puits + v.evaluer(0); }, rien);
+
+        // Mthodes utilitaires. Les sorties texte sont trs lentes: on les limite  10^6 lments.
+        ajouter("getDimension", 0, [&]() { puits = puits + double(a.getDimension()); }, rien);
+        if (_n <= 1000000){
+            ajouter("toString", n * d, [&]() { puits = puits + double(a.toString().size()); }, rien);
+            TamponNul tamponNul;
+            streambuf * ancien = cout.rdbuf(&tamponNul);
+            ajouter("afficher (sortie jetee)", n * d, [&]() { a.afficher(); }, rien);
+            cout.rdbuf(ancien);
+            const string texte = a.toString();
+            ajouter("Vecteur(istream) (analyse)", double(texte.size()), [&]() {
+                istringstream entree(texte);
+                Vecteur v(entree);
+                puits = puits + v.evaluer(0);
+            }, rien);
+        }
+
+        // Entres/sorties binaires (voir FichierVecteur.h). Le fichier est relu depuis la cache du systme: on mesure le format, pas le disque.
+        const string chemin = "bench_vecteur.vec";
+        ajouter("FichierVecteur::ecrire", n * d, [&]() { FichierVecteur::ecrire(chemin, a); }, rien);
+        ajouter("FichierVecteur::lire", n * d, [&]() { Vecteur v = FichierVecteur::lire(chemin); puits = puits + v.evaluer(0); },
+                [&]() { FichierVecteur::ecrire(chemin, a); });
+        ajouter("VecteurMappe + somme", n * d, [&]() { VecteurMappe v(chemin); puits = puits + v.somme(); },
+                [&]() { FichierVecteur::ecrire(chemin, a); });
+
+        // Flux de 64 travaux  lire -> normaliser -> dot  (voir ExecutionAsynchrone.h): en srie sur le fil appelant, puis en pipeline (lecture
+        // sur le rservoir d'entres/sorties, calcul sur le rservoir global; lots de 8 petits travaux, ou de 1 pour les gros).
+        if (_n >= 1000 && _n <= 1000000){
+            struct Travail
+            {
+                Vecteur v;
+                double score;
+            };
+            ajouter("ancien: 64 x (lire, normaliser, dot) en serie", 64 * 2 * n * d, [&]() {
+                for (size_t i = 0; i < 64; i++){
+                    Vecteur v = FichierVecteur::lire(chemin);
+                    v.normaliser();
+                    puits = puits + v.dot(a);
+                }
+            }, [&]() { FichierVecteur::ecrire(chemin, a); });
+            ajouter("Pipeline 64 x (lire, normaliser, dot)", 64 * 2 * n * d, [&]() {
+                Pipeline<Travail> pipeline(_n <= 10000 ? 8 : 1);
+                pipeline.ajouterEtape([&](Travail & _travail) { _travail.v = FichierVecteur::lire(chemin); }, Pipeline<Travail>::ENTREES_SORTIES)
+                        .ajouterEtape([&](Travail & _travail) { _travail.v.normaliser(); _travail.score = _travail.v.dot(a); });
+                for (size_t i = 0; i < 64; i++){
+                    pipeline.pousser(Travail{Vecteur(0, 0.0), 0.0});
+                }
+                pipeline.terminer();
+                puits = puits + double(pipeline.getNombreTraites());
+            }, [&]() { FichierVecteur::ecrire(chemin, a); });
+        }
+        remove(chemin.c_str());
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    const Options options = lireOptions(argc, argv);
+    if (options.precision){
+        analyserPrecision(options);
+        return 0;
+    }
+    const Caches caches = detecterCaches();
+    printf("jeu d'instructions: %s, fils: %zu, caches L1/L2/L3: %zu/%zu/%zu octets\n", Noyaux::nomJeuInstructions(Noyaux::jeuInstructions()),
+           ReservoirTaches::global().getNombreTravailleurs() + 1, caches.l1, caches.l2, caches.l3);
+
+    vector<size_t> dimensions;
+    dimensions.push_back(3);
+    for (size_t dimension = 10; dimension <= options.dimensionMaximale; dimension *= 10){
+        dimensions.push_back(dimension);
+    }
+
+    vector<Resultat> resultats;
+    afficherEntete();
+    for (size_t i = 0; i < dimensions.size(); i++){
+        benchmarkDimension(dimensions[i], options, caches, resultats);
+    }
+    if (!options.fichierJson.empty()){
+        ecrireJson(resultats, options, caches);
+    }
+    if (!options.fichierInstrumentation.empty()){
+        printf("\n");
+        fflush(stdout);
+        InstrumentationVecteur::ecrireRapport(cout);
+        if (options.fichierInstrumentation == "-"){
+            InstrumentationVecteur::ecrireJson(cout);
+        }
+        else {
+            ofstream fichier(options.fichierInstrumentation);
+            InstrumentationVecteur::ecrireJson(fichier);
+        }
+    }
+    return 0;
+}
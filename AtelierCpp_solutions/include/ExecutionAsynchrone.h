@@ -0,0 +1,318 @@
+#ifndef EXECUTIONASYNCHRONE_H
+#define EXECUTIONASYNCHRONE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ReservoirTaches.h"
+
+using namespace std;
+
+/** \brief Excuteur asynchrone born: `soumettre(...)` lance une tche sur un rservoir de fils (voir ReservoirTaches.h) et retourne tout de suite
+ * un `future` pour son rsultat, par exemple `future<double> f = executeur.soumettre([&]() { return a.dot(b); });`.
+ * Au plus `getCapacite()` tches sont en cours  la fois. Au-del, `soumettre` bloque jusqu' ce qu'une tche se termine (contre-pression,
+ *  backpressure ): un producteur plus rapide que les fils ne peut pas accumuler des tches (et leur mmoire) sans limite. Pendant qu'il attend,
+ * le fil appelant excute lui-mme des tches du rservoir au lieu de dormir.
+ * Une exception lance par une tche est relance par `get()` sur son `future`.
+ */
+class ExecuteurBorne
+{
+    public:
+        explicit ExecuteurBorne(const size_t _capacite = 0, ReservoirTaches & _reservoir = ReservoirTaches::global());
+        ~ExecuteurBorne();
+
+        ExecuteurBorne(const ExecuteurBorne &) = delete;
+        ExecuteurBorne & operator=(const ExecuteurBorne &) = delete;
+
+        template <typename F>
+        future<typename invoke_result<F>::type> soumettre(F _tache);
+        void attendre();
+
+        // Mthodes utilitaires
+        size_t getCapacite() const;
+        size_t getEnCours() const;
+
+    private:
+        void reserver();
+        void liberer();
+
+        ReservoirTaches & reservoir;
+        size_t capacite;
+        size_t enCours;
+        mutable mutex verrou;
+        condition_variable place;
+};
+
+/** \brief Lance une tche de faon asynchrone. Bloque tant que la capacit de l'excuteur est atteinte.
+ * \param _tache: fonction sans argument (par exemple une lambda)  excuter sur un fil du rservoir.
+ * \return Le `future` du rsultat de la tche.
+ */
+template <typename F>
+future<typename invoke_result<F>::type> ExecuteurBorne::soumettre(F _tache){
+    typedef typename invoke_result<F>::type Resultat;
+    // packaged_task ne se copie pas, alors que les tches du rservoir (function<void()>) doivent pouvoir l'tre: on la partage.
+    shared_ptr<packaged_task<Resultat()> > tache = make_shared<packaged_task<Resultat()> >(move(_tache));
+    future<Resultat> retour = tache->get_future();
+    reserver();
+    try {
+        reservoir.soumettre([this, tache]() {
+            (*tache)();
+            liberer();
+        });
+    }
+    catch (...){
+        liberer(); // La tche n'a pas t soumise: sa place est rendue, sinon `attendre()` ne se terminerait jamais.
+        throw;
+    }
+    return retour;
+}
+
+/** \brief Pipeline de traitement d'un flux d'lments, par exemple des travaux  lire -> normaliser -> comparer -> crire :
+ *
+ *     struct Travail { string chemin; Vecteur v; double score; };
+ *     Pipeline<Travail> pipeline(16);
+ *     pipeline.ajouterEtape([](Travail & _t) { _t.v = FichierVecteur::lire(_t.chemin); }, Pipeline<Travail>::ENTREES_SORTIES)
+ *             .ajouterEtape([&](Travail & _t) { _t.v.normaliser(); _t.score = _t.v.dot(requete); })
+ *             .ajouterEtape([&](Travail & _t) { ecrireScore(_t); }, Pipeline<Travail>::ENTREES_SORTIES);
+ *     for (...) { pipeline.pousser(Travail{chemin}); }
+ *     pipeline.terminer();
+ *
+ * - Regroupement: les lments sont envoys par lots de `_tailleLot`. Un lot passe par toutes les tapes comme une seule tche par tape, ce qui
+ *   amortit le cot d'une tche (quelques microsecondes) sur plusieurs petits travaux. Un lot devrait tenir dans la cache L2: pour des travaux sur
+ *   de gros Vecteurs (des centaines de Ko), des lots de 1 vitent de garder trop de donnes en vol.
+ * - Chevauchement: les tapes ENTREES_SORTIES s'excutent sur le rservoir d'entres/sorties (`ReservoirTaches::entreesSorties()`), les tapes
+ *   CALCUL sur le rservoir global. Pendant qu'un lot attend le disque, les coeurs calculent les autres lots. Les tapes conscutives de mme type
+ *   s'enchanent sur le mme fil, sans nouvelle tche.
+ * - Contre-pression: au plus `_lotsEnVol` lots sont en cours (par dfaut, deux par fil de calcul, pour que chaque coeur ait toujours un lot
+ *   prt). Au-del, `pousser` bloque (en aidant le rservoir de calcul) jusqu' ce qu'un lot se termine.
+ * Chaque lment passe par les tapes dans l'ordre, mais les lots peuvent se terminer dans le dsordre. Si une tape lance une exception, le
+ * reste de son lot est abandonn et `terminer()` relance la premire exception. `pousser` et `terminer` doivent tre appels par un seul fil.
+ */
+template <typename T>
+class Pipeline
+{
+    public:
+        enum TypeEtape
+        {
+            CALCUL,
+            ENTREES_SORTIES
+        };
+
+        explicit Pipeline(const size_t _tailleLot = 16, const size_t _lotsEnVol = 0, ReservoirTaches & _calcul = ReservoirTaches::global(),
+                          ReservoirTaches & _entreesSorties = ReservoirTaches::entreesSorties());
+        ~Pipeline();
+
+        Pipeline(const Pipeline &) = delete;
+        Pipeline & operator=(const Pipeline &) = delete;
+
+        Pipeline & ajouterEtape(function<void(T &)> _traitement, const TypeEtape _type = CALCUL);
+        void pousser(T _element);
+        void terminer();
+
+        // Mthodes utilitaires
+        size_t getTailleLot() const { return tailleLot; }
+        size_t getLotsEnVol() const { return lotsEnVol; }
+        size_t getNombreTraites() const;
+
+    private:
+        struct Etape
+        {
+            function<void(T &)> traitement;
+            TypeEtape type;
+        };
+
+        ReservoirTaches & reservoirPour(const TypeEtape _type) { return _type == CALCUL ? calcul : entreesSorties; }
+        void envoyerLot();
+        void executer(const shared_ptr<vector<T> > & _lot, const size_t _etape);
+        void attendreLots(const size_t _maximum);
+
+        vector<Etape> etapes;
+        size_t tailleLot;
+        size_t lotsEnVol;
+        ReservoirTaches & calcul;
+        ReservoirTaches & entreesSorties;
+        vector<T> lotCourant;
+        mutable mutex verrou;
+        condition_variable lotTermine;
+        size_t lotsEnCours;
+        size_t nombreTraites;
+        exception_ptr erreur;
+};
+
+/** \brief Constructeur de la classe Pipeline (sans tape: voir `ajouterEtape`).
+ * \param _tailleLot: nombre d'lments par lot (au moins 1).
+ * \param _lotsEnVol: nombre maximal de lots en cours; 0 pour deux par fil de calcul.
+ * \param _calcul: rservoir des tapes CALCUL.
+ * \param _entreesSorties: rservoir des tapes ENTREES_SORTIES.
+ */
+template <typename T>
+Pipeline<T>::Pipeline(const size_t _tailleLot, const size_t _lotsEnVol, ReservoirTaches & _calcul, ReservoirTaches & _entreesSorties)
+    : tailleLot(_tailleLot == 0 ? 1 : _tailleLot), lotsEnVol(_lotsEnVol == 0 ? 2 * (_calcul.getNombreTravailleurs() + 1) : _lotsEnVol),
+      calcul(_calcul), entreesSorties(_entreesSorties), lotsEnCours(0), nombreTraites(0)
+{
+    lotCourant.reserve(tailleLot);
+}
+
+/** \brief Destructeur: comme `terminer()` (les lments dj pousss sont traits), mais ne lance jamais d'exception. Une exception d'une tape
+ * est ignore; si le dernier lot ne peut pas tre envoy (manque de mmoire), ses lments sont abandonns. Pour tre averti de ces erreurs,
+ * appeler `terminer()` avant la destruction.
+ */
+template <typename T>
+Pipeline<T>::~Pipeline()
+{
+    try {
+        if (!lotCourant.empty()){
+            envoyerLot();
+        }
+    }
+    catch (...){
+        // Le lot n'a pas t envoy: aucun lot en cours ne dpend de lui, on attend seulement les autres.
+    }
+    attendreLots(0);
+}
+
+/** \brief Ajoute une tape  la fin du pipeline. Toutes les tapes doivent tre ajoutes avant le premier `pousser`.
+ * \param _traitement: fonction applique  chaque lment (qu'elle peut modifier).
+ * \param _type: CALCUL (rservoir global) ou ENTREES_SORTIES (rservoir d'entres/sorties).
+ * \return *this, pour enchaner les appels.
+ */
+template <typename T>
+Pipeline<T> & Pipeline<T>::ajouterEtape(function<void(T &)> _traitement, const TypeEtape _type){
+    {
+        lock_guard<mutex> garde(verrou);
+        if (lotsEnCours > 0 || !lotCourant.empty()){
+            throw runtime_error("Impossible d'ajouter une tape  un pipeline en cours.");
+        }
+    }
+    Etape etape = {move(_traitement), _type};
+    etapes.push_back(move(etape));
+    return *this;
+}
+
+/** \brief Ajoute un lment au lot courant, et envoie le lot s'il est plein. Bloque si `getLotsEnVol()` lots sont dj en cours.
+ * \param _element: lment  traiter.
+ */
+template <typename T>
+void Pipeline<T>::pousser(T _element){
+    lotCourant.push_back(move(_element));
+    if (lotCourant.size() >= tailleLot){
+        envoyerLot();
+    }
+}
+
+/** \brief Envoie le dernier lot (mme incomplet) et attend que tous les lments soient traits.
+ * Si une tape a lanc une exception, elle est relance ici (une seule fois: le pipeline peut ensuite tre rutilis).
+ */
+template <typename T>
+void Pipeline<T>::terminer(){
+    if (!lotCourant.empty()){
+        envoyerLot();
+    }
+    attendreLots(0);
+    exception_ptr premiere;
+    {
+        lock_guard<mutex> garde(verrou);
+        premiere = erreur;
+        erreur = nullptr;
+    }
+    if (premiere){
+        rethrow_exception(premiere);
+    }
+}
+
+/** \brief Nombre d'lments passs par toutes les tapes depuis la cration du pipeline.
+ */
+template <typename T>
+size_t Pipeline<T>::getNombreTraites() const {
+    lock_guard<mutex> garde(verrou);
+    return nombreTraites;
+}
+
+/** \brief Envoie le lot courant. Si l'envoi choue (manque de mmoire), l'exception est relance et le lot reste le lot courant, intact:
+ * aucun lot en cours n'est compt en trop.
+ */
+template <typename T>
+void Pipeline<T>::envoyerLot(){
+    attendreLots(lotsEnVol - 1);
+    shared_ptr<vector<T> > lot = make_shared<vector<T> >(move(lotCourant));
+    lotCourant = vector<T>();
+    {
+        lock_guard<mutex> garde(verrou);
+        lotsEnCours++;
+    }
+    if (etapes.empty()){
+        executer(lot, 0);
+    }
+    else {
+        try {
+            reservoirPour(etapes[0].type).soumettre([this, lot]() { executer(lot, 0); });
+        }
+        catch (...){
+            lotCourant = move(*lot);
+            lock_guard<mutex> garde(verrou);
+            lotsEnCours--;
+            throw;
+        }
+    }
+    lotCourant.reserve(tailleLot);
+}
+
+/** \brief Excute les tapes d'un lot  partir de `_etape`, jusqu' la fin ou jusqu' la premire tape d'un autre type, qui est alors soumise
+ *  son rservoir. Ne lance jamais d'exception (c'est une tche de ReservoirTaches).
+ */
+template <typename T>
+void Pipeline<T>::executer(const shared_ptr<vector<T> > & _lot, const size_t _etape){
+    bool reussi = true;
+    try {
+        for (size_t etape = _etape; etape < etapes.size(); etape++){
+            if (etape > _etape && etapes[etape].type != etapes[etape - 1].type){
+                shared_ptr<vector<T> > lot = _lot;
+                reservoirPour(etapes[etape].type).soumettre([this, lot, etape]() { executer(lot, etape); });
+                return;
+            }
+            for (size_t i = 0; i < _lot->size(); i++){
+                etapes[etape].traitement((*_lot)[i]);
+            }
+        }
+    }
+    catch (...){
+        reussi = false;
+        lock_guard<mutex> garde(verrou);
+        if (!erreur){
+            erreur = current_exception();
+        }
+    }
+    // On avertit en gardant le verrou: ds qu'il est relch, le pipeline peut tre dtruit par le fil qui attend.
+    lock_guard<mutex> garde(verrou);
+    if (reussi){
+        nombreTraites += _lot->size();
+    }
+    lotsEnCours--;
+    lotTermine.notify_all();
+}
+
+/** \brief Attend qu'il reste au plus `_maximum` lots en cours. En attendant, le fil excute des tches du rservoir de calcul.
+ */
+template <typename T>
+void Pipeline<T>::attendreLots(const size_t _maximum){
+    unique_lock<mutex> garde(verrou);
+    while (lotsEnCours > _maximum){
+        garde.unlock();
+        const bool aide = calcul.aider();
+        garde.lock();
+        if (!aide && lotsEnCours > _maximum){
+            lotTermine.wait_for(garde, chrono::milliseconds(1));
+        }
+    }
+}
+
+#endif // EXECUTIONASYNCHRONE_H
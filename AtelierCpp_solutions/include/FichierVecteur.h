@@ -0,0 +1,125 @@
+#ifndef FICHIERVECTEUR_H
+#define FICHIERVECTEUR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Vecteur.h"
+#include "VecteurExpression.h"
+#include "VueVecteur.h"
+
+using namespace std;
+
+/** \brief Format binaire des fichiers de Vecteurs (extension suggre: `.vec`).
+ * Le fichier commence par un en-tte de 64 octets, suivi des lments bruts (les doubles, tels qu'ils sont en mmoire). Les lments commencent 
+ * `decalageDonnees`, un multiple de `alignement` (64 octets, une ligne de cache;  la lecture, tout multiple de 64 est accept): une fois le fichier projet en mmoire (voir VecteurMappe),
+ * ils sont donc aligns comme ceux d'un VecteurBatch et les noyaux SIMD peuvent les lire directement.
+ * Contrairement  `toString()`, l'criture et la lecture ne font aucune conversion en texte: aucune perte de prcision et le cot se limite 
+ * celui du disque.
+ */
+struct EnteteFichierVecteur
+{
+    static const uint32_t VERSION = 1;
+    static const uint32_t MARQUEUR_BOUTISME = 0x01020304; // Relu autrement si le fichier vient d'une machine de boutisme (endianness) diffrent.
+    static const uint32_t ALIGNEMENT = 64;
+
+    enum TypeDonnees
+    {
+        FLOAT64 = 1
+    };
+
+    char signature[8];        // "VECTEUR" suivi d'un zro
+    uint32_t version;
+    uint32_t marqueurBoutisme;
+    uint32_t typeDonnees;     // TypeDonnees
+    uint32_t tailleElement;   // en octets
+    uint64_t dimension;
+    uint64_t alignement;
+    uint64_t decalageDonnees; // position du premier lment dans le fichier, en octets
+    uint8_t reserve[16];
+};
+
+/** \brief criture et lecture de Vecteurs dans le format binaire dcrit par EnteteFichierVecteur.
+ * Les erreurs (fichier introuvable, fichier d'un autre format, fichier tronqu, etc.) lancent une `runtime_error`.
+ */
+namespace FichierVecteur
+{
+    /** \brief crit un Vecteur dans un fichier (remplac s'il existe dj).
+     * \param _chemin: chemin du fichier.
+     * \param _vecteur: Vecteur  crire.
+     */
+    void ecrire(const string & _chemin, const Vecteur & _vecteur);
+
+    /** \brief crit des lments bruts dans un fichier, par exemple une ligne de VecteurBatch (`ecrire(chemin, batch.ligne(i), dim)`).
+     */
+    void ecrire(const string & _chemin, const double * _elements, const size_t _dimension);
+
+    /** \brief Lit un fichier complet dans un nouveau Vecteur (copie en mmoire, allou dans la ressource courante du fil). Pour ne rien copier,
+     * voir VecteurMappe.
+     * \param _chemin: chemin du fichier.
+     * \return Le Vecteur lu.
+     */
+    Vecteur lire(const string & _chemin);
+
+    /** \brief Lit et valide l'en-tte d'un fichier sans lire les lments.
+     */
+    EnteteFichierVecteur lireEntete(const string & _chemin);
+}
+
+/** \brief Vue en lecture seule d'un fichier de Vecteur projet en mmoire (mmap sous POSIX, MapViewOfFile sous Windows), sans aucune copie.
+ * L'ouverture est quasi instantane, peu importe la taille du fichier: le systme d'exploitation charge les pages seulement quand on les lit
+ * (et peut les partager entre plusieurs processus qui ouvrent le mme fichier). C'est donc la faon de charger de trs gros Vecteurs au dmarrage.
+ * VecteurMappe est une expression vectorielle (voir VecteurExpression.h): on peut l'utiliser directement dans les calculs (`Vecteur r = mappe + a;`,
+ * `mappe.dot(a)`) ou le copier dans un Vecteur modifiable (`Vecteur v = mappe;`). Les lments ne peuvent pas tre modifis.
+ * Le fichier doit rester inchang tant que la vue existe. Une vue ne peut pas tre copie, seulement dplace.
+ */
+class VecteurMappe : public ExpressionVecteur<VecteurMappe>
+{
+    public:
+        explicit VecteurMappe(const string & _chemin);
+        VecteurMappe(VecteurMappe && _autre) noexcept;
+        VecteurMappe & operator=(VecteurMappe && _autre) noexcept;
+        ~VecteurMappe();
+
+        VecteurMappe(const VecteurMappe &) = delete;
+        VecteurMappe & operator=(const VecteurMappe &) = delete;
+
+        // Accs (lecture seule)
+        double operator[](const size_t _index) const;
+        double evaluer(const size_t _index) const { return donnees[_index]; }
+        const double * getDonnees() const;
+        VecteurVueConst vue() const;
+
+        // Mathmatiques (noyaux SIMD, voir Noyaux.h)
+        using ExpressionVecteur<VecteurMappe>::dot;
+        double dot(const VecteurMappe & _autre) const;
+        double somme() const;
+        double norme() const;
+
+        // Mthodes utilitaires
+        size_t getDimension() const;
+        void precharger() const;
+
+    private:
+        void fermer();
+
+        const double * donnees;
+        size_t dimension;
+        void * projection;      // dbut de la projection (l'en-tte)
+        size_t tailleProjection;
+#ifdef _WIN32
+        void * fichier;
+        void * objetProjection;
+#endif
+};
+
+/** \brief Comme un Vecteur, une vue projete est conserve par rfrence dans les expressions (elle n'est pas copiable).
+ */
+template <>
+struct StockageExpression<VecteurMappe>
+{
+    typedef const VecteurMappe & type;
+};
+
+#endif // FICHIERVECTEUR_H
@@ -0,0 +1,174 @@
+#ifndef INSTRUMENTATIONVECTEUR_H
+#define INSTRUMENTATIONVECTEUR_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+using namespace std;
+
+/** \brief Instrumentation (optionnelle) des oprations de Vecteur: pour chaque mthode, nombre d'appels, d'lments traits, d'allocations et
+ * d'octets copis, plus le temps total et un histogramme des dures.
+ *
+ * Elle est active en compilant avec `-DVECTEUR_INSTRUMENTATION`. Sinon, les macros d'instrumentation (plus bas) ne gnrent
+ * aucun code: rien n'est compt ni mesur, et les mthodes de Vecteur sont exactement les mmes qu'avant. Les fonctions de lecture et d'criture
+ * (`statistiques`, `ecrireJson`, `ecrireRapport`) existent dans les deux cas; sans instrumentation, tous les compteurs restent  zro.
+ *
+ * Cot quand elle est active: deux lectures de l'horloge (`steady_clock`, environ 20 ns chacune) et quelques additions atomiques (relches) par
+ * appel mesur. C'est ngligeable pour les oprations sur de gros Vecteurs, mais visible pour de tout petits. Les compteurs de chaque opration
+ * sont sur leur propre ligne de cache: des fils qui appellent des oprations diffrentes ne se ralentissent pas.
+ *
+ * Ce qui est compt:
+ * - elements: nombre d'lments lus ou crits par l'opration (la dimension, en gnral).
+ * - allocations: nombre de blocs d'lments allous (un nouveau Vecteur, ou un Vecteur existant qui doit grandir).
+ * - octets: octets d'lments copis ou crits dans un nouveau stockage (pas ceux simplement lus).
+ * Les oprateurs paresseux (`a + b`, `a * 2.0`, voir VecteurExpression.h) ne font rien au moment o on les crit: le travail est compt l o
+ * l'expression est value (EVALUATION_EXPRESSION, ASSIGNATION_EXPRESSION, AJOUTER, etc.). Comme dans `perf`, une opration compte aussi le
+ * travail des oprations qu'elle appelle, qui sont en plus comptes sparment: `exposant(...)` cre son rsultat avec `Vecteur(dimension, valeur)`.
+ */
+namespace InstrumentationVecteur
+{
+    enum Operation
+    {
+        CONSTRUCTEUR_COPIE,
+        CONSTRUCTEUR_DEPLACEMENT,
+        CONSTRUCTEUR_DIMENSION,
+        CONSTRUCTEUR_VALEURS,
+        CONSTRUCTEUR_INTERVALLE,
+        CONSTRUCTEUR_ANALYSE,
+        EVALUATION_EXPRESSION,
+        ASSIGNATION_COPIE,
+        ASSIGNATION_DEPLACEMENT,
+        ASSIGNATION_EXPRESSION,
+        AJOUTER,
+        SOUSTRAIRE,
+        AJOUTER_SCALAIRE,
+        SOUSTRAIRE_SCALAIRE,
+        MULTIPLIER_SCALAIRE,
+        DIVISER_SCALAIRE,
+        DOT,
+        CROSS,
+        EXPOSANT,
+        EXPOSANT_EN_PLACE,
+        SOMME,
+        PROD,
+        NORME,
+        LOG_PROD,
+        TEXTE,
+        AXPY,
+        AXPBY,
+        NORMALISER,
+        DOT_ET_NORMES,
+        DISTANCE,
+        NOMBRE_OPERATIONS
+    };
+
+    /** \brief Nombre d'intervalles de l'histogramme des dures. L'intervalle i contient les appels d'une dure de [2^i, 2^(i+1)[ nanosecondes
+     * (l'intervalle 0 contient aussi les dures nulles, le dernier toutes les dures plus longues).
+     */
+    const size_t NOMBRE_INTERVALLES = 40;
+
+    /** \brief Copie des compteurs d'une opration.
+     */
+    struct Statistiques
+    {
+        uint64_t appels;
+        uint64_t elements;
+        uint64_t allocations;
+        uint64_t octets;
+        uint64_t nanosecondes;
+        uint64_t histogramme[NOMBRE_INTERVALLES];
+    };
+
+    /** \brief Vrai si le programme est compil avec l'instrumentation (VECTEUR_INSTRUMENTATION).
+     */
+    constexpr bool estActive(){
+#ifdef VECTEUR_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /** \brief Nom lisible d'une opration (ex.: "dot").
+     */
+    const char * nomOperation(const Operation _operation);
+
+    /** \brief Ajoute un appel aux compteurs d'une opration. Normalement appele par les macros plus bas.
+     * \param _operation: opration mesure.
+     * \param _elements: lments traits.
+     * \param _allocations: blocs d'lments allous.
+     * \param _octets: octets copis ou crits dans un nouveau stockage.
+     * \param _nanosecondes: dure de l'appel (0 si elle n'est pas mesure).
+     */
+    void enregistrer(const Operation _operation, const uint64_t _elements, const uint64_t _allocations, const uint64_t _octets,
+                     const uint64_t _nanosecondes);
+
+    /** \brief Compteurs actuels d'une opration. Pendant que d'autres fils enregistrent des appels, chaque compteur est exact, mais ils peuvent
+     * ne pas tous reflter le mme nombre d'appels.
+     */
+    Statistiques statistiques(const Operation _operation);
+
+    /** \brief Remet tous les compteurs  zro (par exemple aprs l'initialisation, pour ne mesurer que la suite).
+     */
+    void reinitialiser();
+
+    /** \brief crit tous les compteurs en JSON: `{"instrumentation": true, "operations": [{"operation": "dot", "appels": ..., "histogramme_ns":
+     * [...]}, ...]}`. Seules les oprations appeles au moins une fois sont crites.
+     */
+    void ecrireJson(ostream & _sortie);
+
+    /** \brief crit un rapport texte tri par temps total dcroissant, dans l'esprit de `perf report`: une ligne par opration (pourcentage du temps
+     * mesur, appels, temps total et moyen, lments, allocations, octets), suivie des percentiles approximatifs (mdiane et 99e) tirs de
+     * l'histogramme.
+     */
+    void ecrireRapport(ostream & _sortie);
+
+    /** \brief Mesure la dure de la porte (RAII) et l'enregistre  la destruction. Utilis par `INSTRUMENTER_VECTEUR`.
+     */
+    class Chronometre
+    {
+        public:
+            Chronometre(const Operation _operation, const uint64_t _elements, const uint64_t _allocations, const uint64_t _octets)
+                : operation(_operation), elements(_elements), allocations(_allocations), octets(_octets), debut(chrono::steady_clock::now()) {}
+
+            ~Chronometre(){
+                const chrono::steady_clock::duration duree = chrono::steady_clock::now() - debut;
+                enregistrer(operation, elements, allocations, octets, uint64_t(chrono::duration_cast<chrono::nanoseconds>(duree).count()));
+            }
+
+            /** \brief Remplace les quantits comptes, quand elles ne sont connues qu' la fin (par exemple le nombre d'lments lus d'un flux).
+             */
+            void completer(const uint64_t _elements, const uint64_t _allocations, const uint64_t _octets){
+                elements = _elements;
+                allocations = _allocations;
+                octets = _octets;
+            }
+
+            Chronometre(const Chronometre &) = delete;
+            Chronometre & operator=(const Chronometre &) = delete;
+
+        private:
+            Operation operation;
+            uint64_t elements;
+            uint64_t allocations;
+            uint64_t octets;
+            chrono::steady_clock::time_point debut;
+    };
+}
+
+/* INSTRUMENTER_VECTEUR(OPERATION, elements, allocations, octets):  placer au dbut d'une mthode; compte l'appel et mesure sa dure jusqu' la fin
+ * de la porte. COMPLETER_INSTRUMENTATION_VECTEUR(elements, allocations, octets): corrige les quantits plus loin dans la mme porte.
+ * Sans VECTEUR_INSTRUMENTATION, les macros ne gnrent rien et leurs arguments ne sont mme pas valus.
+ */
+#ifdef VECTEUR_INSTRUMENTATION
+#define INSTRUMENTER_VECTEUR(operation, elements, allocations, octets) \
+    InstrumentationVecteur::Chronometre chronometreInstrumentation(InstrumentationVecteur::operation, (elements), (allocations), (octets))
+#define COMPLETER_INSTRUMENTATION_VECTEUR(elements, allocations, octets) chronometreInstrumentation.completer((elements), (allocations), (octets))
+#else
+#define INSTRUMENTER_VECTEUR(operation, elements, allocations, octets) ((void)0)
+#define COMPLETER_INSTRUMENTATION_VECTEUR(elements, allocations, octets) ((void)0)
+#endif
+
+#endif // INSTRUMENTATIONVECTEUR_H
@@ -0,0 +1,71 @@
+#ifndef MATRICE_H
+#define MATRICE_H
+
+#include <vector>
+
+#include "Vecteur.h"
+#include "VecteurBatch.h"
+#include "PolitiqueExecution.h"
+
+using namespace std;
+
+/** \brief Matrice dense de nombreLignes x nombreColonnes doubles, range par lignes dans un VecteurBatch (lignes alignes sur 64 octets, voir
+ * VecteurBatch.h). Elle se combine directement avec Vecteur: produit matrice-vecteur, vecteur-matrice, produit extrieur, et produit appliqu 
+ * tout un lot de vecteurs (le cas d'un modle linaire dont on applique les mmes poids  des millions de vecteurs).
+ *
+ * Boucler soi-mme `dot` sur les lignes relit le vecteur d'entre une fois par ligne. Ici, les produits passent par les noyaux de niveau 2 de
+ * Noyaux.h, qui traitent les lignes par groupes de 4 (chaque lment du vecteur est lu une fois pour 4 lignes), et sont dcoups en blocs qui
+ * restent dans la cache:
+ * - produit(Vecteur): chaque groupe de 4 lignes est lu une seule fois, en continu; le vecteur reste dans la cache L1/L2.
+ * - produitTransposee(Vecteur): les colonnes sont coupes en blocs de 512 (4 Ko): le morceau du rsultat reste dans la cache L1 pendant qu'on
+ *   parcourt toutes les lignes.
+ * - produit(VecteurBatch): les lignes de la matrice sont coupes en tuiles d'environ 128 Ko, qui restent dans la cache L2 pendant qu'on y passe
+ *   tous les vecteurs du lot. Une matrice qui tient dans la cache L2 n'est lue qu'une seule fois depuis la mmoire, et le lot aussi.
+ * Avec une PolitiqueExecution parallle, le travail est rparti entre les fils sans rien changer au calcul: le rsultat est le mme, bit pour bit,
+ * qu'en squentiel. Chaque ligne de `produit(VecteurBatch)` est aussi identique  `produit(Vecteur)` sur le mme vecteur.
+ */
+class Matrice
+{
+    public:
+        // Constructeurs
+        Matrice(const size_t _nombreLignes, const size_t _nombreColonnes, const double _valeurInitiale = 0);
+        Matrice(const vector<Vecteur> & _lignes);
+        explicit Matrice(const VecteurBatch & _lignes);
+        explicit Matrice(VecteurBatch && _lignes);
+        static Matrice identite(const size_t _taille);
+        static Matrice produitExterieur(const Vecteur & _u, const Vecteur & _v,
+                                        const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle());
+
+        // Accs aux lments, aux lignes et aux colonnes
+        double & operator()(const size_t _ligne, const size_t _colonne);
+        double operator()(const size_t _ligne, const size_t _colonne) const;
+        Vecteur ligne(const size_t _ligne) const;
+        Vecteur colonne(const size_t _colonne) const;
+        VecteurVue vueLigne(const size_t _ligne);
+        VecteurVueConst vueLigne(const size_t _ligne) const;
+        VecteurVue vueColonne(const size_t _colonne);
+        VecteurVueConst vueColonne(const size_t _colonne) const;
+        void definirLigne(const size_t _ligne, const Vecteur & _valeurs);
+        const VecteurBatch & getLignes() const;
+
+        // Produits
+        Vecteur produit(const Vecteur & _x, const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        Vecteur produitTransposee(const Vecteur & _x, const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        VecteurBatch produit(const VecteurBatch & _vecteurs, const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        Matrice & ajouterProduitExterieur(const double _alpha, const Vecteur & _u, const Vecteur & _v,
+                                          const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle());
+        Matrice transposee() const;
+
+        // Mthodes utilitaires
+        size_t getNombreLignes() const;
+        size_t getNombreColonnes() const;
+        size_t getPas() const;
+
+    private:
+        VecteurBatch lignes;
+};
+
+Vecteur operator*(const Matrice & _matrice, const Vecteur & _x);
+Vecteur operator*(const Vecteur & _x, const Matrice & _matrice);
+
+#endif // MATRICE_H
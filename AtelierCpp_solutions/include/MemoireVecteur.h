@@ -0,0 +1,48 @@
+#ifndef MEMOIREVECTEUR_H
+#define MEMOIREVECTEUR_H
+
+#include <memory_resource>
+
+using namespace std;
+
+/** \brief Ressources mmoire (allocateurs) pour les lments des Vecteurs.
+ * Les lments d'un Vecteur sont stocks dans un `pmr::vector<double>`, qui demande sa mmoire  une `pmr::memory_resource`. Par dfaut, c'est le tas
+ * global (new/delete), comme avant. Pour viter malloc/free, on peut plutt donner  un Vecteur (ou  tout un calcul) une ressource comme:
+ * - AreneVecteur: une arne  bump : chaque allocation avance simplement un pointeur dans un grand bloc. Librer ne fait rien; toute la mmoire
+ *   est rendue d'un coup, quand l'arne est dtruite (ou avec `release()`), peu importe le nombre d'allocations.
+ * - ReservoirMemoireVecteur: un rservoir par classes de tailles, qui rutilise les blocs librs de mme taille.
+ * Ces deux ressources ne sont pas synchronises (pas de verrou): on en utilise une par fil d'excution, ce qui vite aussi la contention de
+ * l'allocateur global quand plusieurs fils allouent en mme temps.
+ */
+typedef pmr::monotonic_buffer_resource AreneVecteur;
+typedef pmr::unsynchronized_pool_resource ReservoirMemoireVecteur;
+
+/** \brief Choisit la ressource mmoire utilise par tous les Vecteurs crs sur le fil courant, le temps de la porte (RAII).
+ * Exemple, pour qu'une tape de calcul complte (temporaires des oprateurs compris) alloue dans une arne libre d'un coup  la fin:
+ *
+ *     {
+ *         AreneVecteur arene(1 << 20);
+ *         PorteeMemoire portee(&arene);
+ *         Vecteur c = a.cross(b);  // allou dans l'arne
+ *         ...
+ *     }   // les Vecteurs de la porte sont dtruits, puis l'arne rend toute sa mmoire
+ *
+ * Attention: un Vecteur allou dans une ressource ne doit pas survivre  celle-ci. Pour garder un rsultat, on le copie aprs la porte
+ * (une copie utilise la ressource courante du fil, pas celle de l'original).
+ */
+class PorteeMemoire
+{
+    public:
+        explicit PorteeMemoire(pmr::memory_resource * _ressource);
+        ~PorteeMemoire();
+
+        PorteeMemoire(const PorteeMemoire &) = delete;
+        PorteeMemoire & operator=(const PorteeMemoire &) = delete;
+
+        static pmr::memory_resource * ressourceCourante();
+
+    private:
+        pmr::memory_resource * precedente;
+};
+
+#endif // MEMOIREVECTEUR_H
@@ -0,0 +1,169 @@
+#ifndef NOYAUX_H
+#define NOYAUX_H
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+/** \brief Noyaux de calcul bas niveau (SIMD) utiliss par la classe Vecteur.
+ * Chaque noyau existe en plusieurs versions: scalaire (portable), SSE2, AVX2 et AVX-512. La meilleure version supporte par le processeur est choisie
+ * une seule fois,  l'excution, au premier appel. On peut aussi forcer une version avec `choisirJeuInstructions(...)` (utile pour comparer).
+ *
+ * Garanties de prcision par rapport aux anciennes boucles scalaires (une seule somme accumule dans l'ordre):
+ * - Les oprations lment par lment (`ajouter`, `multiplierScalaire`, etc.) donnent exactement les mmes rsultats, bit pour bit: chaque
+ *   lment subit la mme opration IEEE 754, peu importe la version.
+ * - Les rductions (`somme`, `produitScalaire`, `sommeCarres`) calculent exactement les mmes termes, mais les additionnent avec plusieurs
+ *   accumulateurs indpendants (P sommes partielles: 4 en scalaire, 8 en SSE2, 16 en AVX2, 32 en AVX-512), qu'on combine  la fin. Seul l'ordre
+ *   des additions change. Avec u = 2^-53, la borne d'erreur classique passe de (n - 1) * u * somme(|x_i|) pour la boucle squentielle 
+ *   environ (n / P + log2(P)) * u * somme(|x_i|): elle n'est jamais pire, et l'cart entre l'ancien et le nouveau rsultat est born par la somme
+ *   des deux. Quand les termes sont de mme signe, l'cart relatif est donc d'au plus environ n * u.
+ * - `produit` a une erreur relative d'au plus (n - 1) * u dans les deux cas; par contre, l'ordre diffrent peut changer l'endroit o un dpassement
+ *   (overflow vers inf) ou un sous-dpassement (underflow vers 0) survient dans les produits intermdiaires.
+ * - Dans tous les cas, le rsultat d'une version donne est dterministe (mme entre, mme rsultat), mais peut diffrer lgrement d'une version
+ *    l'autre (ex.: AVX2 contre AVX-512) pour les rductions.
+ */
+namespace Noyaux
+{
+    enum JeuInstructions
+    {
+        SCALAIRE = 0,
+        SSE2 = 1,
+        AVX2 = 2,
+        AVX512 = 3
+    };
+
+    /** \brief Jeu d'instructions actuellement utilis par les noyaux.
+     */
+    JeuInstructions jeuInstructions();
+
+    /** \brief Nom lisible du jeu d'instructions (ex.: "avx2").
+     */
+    const char * nomJeuInstructions(const JeuInstructions _jeu);
+
+    /** \brief Meilleur jeu d'instructions support par le processeur courant.
+     */
+    JeuInstructions jeuInstructionsDetecte();
+
+    /** \brief Force l'utilisation d'un jeu d'instructions. Si le processeur ne le supporte pas, on prend le meilleur jeu support qui lui est infrieur.
+     * \param _jeu: jeu d'instructions dsir.
+     * \return Le jeu d'instructions rellement utilis.
+     */
+    JeuInstructions choisirJeuInstructions(const JeuInstructions _jeu);
+
+    // Rductions
+    double produitScalaire(const double * _a, const double * _b, const size_t _taille);
+    double somme(const double * _a, const size_t _taille);
+    double produit(const double * _a, const size_t _taille);
+    double sommeCarres(const double * _a, const size_t _taille);
+
+    /** \brief Stratgie de rduction (somme, produit scalaire, somme des carrs), pour choisir le compromis vitesse/prcision.
+     * Avec u = 2^-53 et S = somme(|x_i|) (ou somme(|a_i * b_i|) pour le produit scalaire), l'erreur absolue est borne par environ:
+     * - RAPIDE: (n / P + log2(P)) * u * S, avec P accumulateurs (voir plus haut). C'est la version par dfaut des mthodes de Vecteur.
+     * - PAR_PAIRES: (B / P + log2(P) + log2(n / B)) * u * S. Le tableau est coup rcursivement en deux jusqu' des blocs de B = 256 lments,
+     *   somms par le noyau RAPIDE. L'erreur ne crot plus qu'en log2(n), pour une vitesse presque identique (un appel par bloc).
+     * - COMPENSEE: u * |rsultat| + n^2 * u^2 * S. Sommation compense de Neumaier (l'erreur d'arrondi exacte de chaque addition est calcule et
+     *   accumule  part); pour le produit scalaire, l'erreur exacte de chaque produit est aussi rcupre avec une FMA (algorithme Dot2 d'Ogita,
+     *   Rump et Oishi). Le rsultat est aussi prcis que si on avait calcul en quadruple prcision, puis arrondi. Environ 3  5 fois plus lent
+     *   que RAPIDE quand les donnes sont en cache, 1.5 fois quand le calcul est limit par la mmoire.
+     * L'erreur relative est l'erreur absolue divise par |rsultat|: quand les termes s'annulent (S beaucoup plus grand que |rsultat|, mauvais
+     * conditionnement), seule COMPENSEE garde un rsultat relativement prcis (jusqu' un conditionnement d'environ 1 / (n * u)).
+     */
+    enum Reduction
+    {
+        RAPIDE = 0,
+        PAR_PAIRES = 1,
+        COMPENSEE = 2
+    };
+
+    double produitScalaire(const double * _a, const double * _b, const size_t _taille, const Reduction _reduction);
+    double somme(const double * _a, const size_t _taille, const Reduction _reduction);
+    double sommeCarres(const double * _a, const size_t _taille, const Reduction _reduction);
+
+    /** \brief Produit des lments sans dpassement intermdiaire: le rsultat est `retour * 2^_exposant`, avec 0.5 <= |retour| < 1 (ou retour
+     * nul, infini ou NaN). Les mantisses et les exposants des lments sont multiplis sparment: le produit ne devient jamais infini ou nul
+     * en cours de route, mme si le produit final ne tient pas dans un double. L'erreur relative est d'au plus (n - 1) * u, comme `produit`.
+     * \param _exposant: (sortie) exposant en base 2 du produit.
+     * \return La mantisse du produit.
+     */
+    double produitEchelonne(const double * _a, const size_t _taille, int64_t & _exposant);
+
+    /* Niveau 1 de BLAS: mises  jour et rductions combines, en un seul passage sur la mmoire. Chaque produit-addition est une FMA (un seul
+     * arrondi au lieu de deux): versions AVX2 + FMA (aussi utilises sur les processeurs AVX-512) et portable (`fma` de la bibliothque standard,
+     * mule si le processeur n'a pas la FMA). Pour `axpy` et `axpby`, chaque lment donne donc le mme rsultat, bit pour bit, peu importe la
+     * version; il peut par contre diffrer d'un ulp de `y += x * a` (deux arrondis). Les rductions suivent les garanties des rductions plus haut.
+     * - axpy: y = a * x + y
+     * - axpby: y = a * x + b * y
+     * - produitScalaireEtSommesCarres: retourne a  b, et calcule a  a et b  b dans le mme passage (par exemple pour un cosinus).
+     * - distanceCarree: somme des (a_i - b_i)^2, sans tableau intermdiaire a - b.
+     * `_y` peut tre gal  `_x`.
+     */
+    void axpy(double * _y, const double _a, const double * _x, const size_t _taille);
+    void axpby(double * _y, const double _a, const double * _x, const double _b, const size_t _taille);
+    double produitScalaireEtSommesCarres(const double * _a, const double * _b, const size_t _taille, double & _carresA, double & _carresB);
+    double distanceCarree(const double * _a, const double * _b, const size_t _taille);
+
+    /* Niveau 2 de BLAS, sur un bloc de `_nombreLignes` lignes de `_taille` lments, espaces de `_pas` doubles (voir Matrice.h). Versions AVX-512,
+     * AVX2 + FMA et portable.
+     * - produitsScalairesLignes: `_resultats[v * _pasResultats + i] = ligne i  vecteur v`, pour `_nombreVecteurs` vecteurs espacs de
+     *   `_pasVecteurs` doubles. Le calcul est fait par blocs de 4 lignes x 4 vecteurs (2 en AVX2 et en portable), gards dans les registres:
+     *   chaque lment charg sert  plusieurs FMA au lieu d'une. Chaque paire (ligne, vecteur) a son propre accumulateur; les lignes restantes
+     *   (moins de 4) passent par `produitScalaire`. Le rsultat d'une paire dpend donc seulement de l'index de la ligne dans le bloc: jamais des
+     *   autres lignes, ni du nombre de vecteurs.
+     * - combinaisonLignes: `_y += somme des _coefficients[i] * ligne i`, par groupes de 4 lignes (chaque lment de `_y` est lu et crit une fois
+     *   par groupe). Pour chaque lment, les FMA sont faites dans l'ordre des lignes: le rsultat est le mme, bit pour bit, qu'une suite d'appels
+     *    `axpy`, peu importe la version ou la faon de dcouper les colonnes.
+     */
+    void produitsScalairesLignes(const double * _lignes, const size_t _pas, const size_t _nombreLignes, const double * _vecteurs,
+                                 const size_t _pasVecteurs, const size_t _nombreVecteurs, const size_t _taille, double * _resultats,
+                                 const size_t _pasResultats);
+    void combinaisonLignes(double * _y, const double * _lignes, const size_t _pas, const size_t _nombreLignes, const double * _coefficients,
+                           const size_t _taille);
+
+    /** \brief lve chaque lment  la puissance `_puissance`, comme `pow`. `_destination` peut tre gale  `_source` (calcul en place).
+     * Les puissances courantes vitent `pow` (trs lent, et jamais vectoris). Erreurs mesures, en ulp (pow: moins de 1 ulp):
+     * - entires de -2  4: multiplications rptes, puis inverse si p < 0. p = 2 et p = -1 sont correctement arrondis, p = 3: 1.3 ulp,
+     *   p = 4: 1.9 ulp, p = -2: 1.5 ulp. Pour p < 0, les lments dont x^|p| dpasse (infini) ou devient sous-normal, ou dont le rsultat est
+     *   sous-normal, passent par pow (1 / x^|p| serait sinon nul ou imprcis).
+     * - 0.5: sqrt(x) (correctement arrondi, comme pow), 1.5 et 2.5: x^k * sqrt(x) (1.3 et 1.9 ulp), -0.5: 1 / sqrt(x) (1.5 ulp), 0.25:
+     *   sqrt(sqrt(x)) (0.8 et 1.9 ulp). Cas limites: sqrt(-0) = -0 et sqrt(-inf) = NaN, alors que pow(-0, 0.5) = +0 et pow(-inf, 0.5) = +inf.
+     *   On reproduit pow: -0 est trait comme +0, et -inf donne +inf (p > 0) ou +0 (p < 0). Les autres nombres ngatifs donnent NaN, comme pow.
+     * - autres puissances, |p| <= 32: noyau AVX2 + FMA exp(p * log(x)), calcul en double-double: au plus 1.05 ulp pour |p| <= 4, 1.5 ulp
+     *   pour |p| <= 16 et 2.2 ulp pour |p| <= 32. Les lments hors de son domaine (x <= 0, sous-normal, infini ou NaN, rsultat hors de
+     *   [e^-708, e^708]) passent par pow.
+     * - sinon (ou sans AVX2 + FMA pour les autres puissances): pow.
+     * Les valeurs spciales (0, infinis, NaN) donnent toujours le mme rsultat que pow.
+     */
+    void puissance(double * _destination, const double * _source, const double _puissance, const size_t _taille);
+
+    /** \brief crit `_destination[i] = _debut + (_premierIndex + i) * _pas` pour i de 0  `_taille` (lment `_premierIndex + i` d'un intervalle,
+     * voir ExpressionIntervalle dans VecteurExpression.h). Le rsultat est le mme, bit pour bit, peu importe la version.
+     */
+    void remplirIntervalle(double * _destination, const double _debut, const double _pas, const size_t _premierIndex, const size_t _taille);
+
+    // Oprations en place, lment par lment
+    void ajouter(double * _destination, const double * _source, const size_t _taille);
+    void soustraire(double * _destination, const double * _source, const size_t _taille);
+    void ajouterScalaire(double * _destination, const double _scalaire, const size_t _taille);
+    void multiplierScalaire(double * _destination, const double _scalaire, const size_t _taille);
+    void diviserScalaire(double * _destination, const double _scalaire, const size_t _taille);
+
+    /* Rductions sur des lments compacts (voir VecteurCompact.h), avec accumulation en plus haute prcision. Versions portable et AVX2 (aussi
+     * utilise sur les processeurs AVX-512).
+     * - float et bfloat16 (donn par ses 16 bits): chaque lment est converti en double sans perte, et le produit de deux lments est exact en
+     *   double (24 + 24 bits de mantisse, moins que 53). Les sommes partielles sont en double: la prcision est donc la mme que celle des noyaux
+     *   double ci-dessus, seule la lecture de la mmoire est 2 ou 4 fois plus petite.
+     * - int8: les produits et les sommes sont calculs en entiers (int32 par blocs, puis int64): le rsultat est exact.
+     */
+    double produitScalaire(const float * _a, const float * _b, const size_t _taille);
+    double somme(const float * _a, const size_t _taille);
+    double sommeCarres(const float * _a, const size_t _taille);
+    double produitScalaireBfloat16(const uint16_t * _a, const uint16_t * _b, const size_t _taille);
+    double sommeBfloat16(const uint16_t * _a, const size_t _taille);
+    double sommeCarresBfloat16(const uint16_t * _a, const size_t _taille);
+    int64_t produitScalaire(const int8_t * _a, const int8_t * _b, const size_t _taille);
+    int64_t somme(const int8_t * _a, const size_t _taille);
+    int64_t sommeCarres(const int8_t * _a, const size_t _taille);
+}
+
+#endif // NOYAUX_H
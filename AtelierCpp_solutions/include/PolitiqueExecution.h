@@ -0,0 +1,61 @@
+#ifndef POLITIQUEEXECUTION_H
+#define POLITIQUEEXECUTION_H
+
+#include <cstddef>
+#include <functional>
+
+using namespace std;
+
+/** \brief Politique d'excution des mthodes de Vecteur (un peu comme `std::execution::seq` et `std::execution::par`).
+ * Par dfaut, tout s'excute sur le fil courant. Avec `PolitiqueExecution::parallele()`, les boucles et rductions sur des Vecteurs dont la dimension
+ * atteint le seuil sont dcoupes en morceaux et rparties sur le rservoir de fils global (voir ReservoirTaches.h). Sous le seuil, le calcul reste
+ * squentiel et donne exactement le mme rsultat qu'avant.
+ *
+ * Rductions (somme, dot, norme, prod): chaque morceau calcule un rsultat partiel, puis on combine les partiels dans l'ordre des morceaux.
+ * - Mode dterministe: les morceaux ont une taille fixe (TAILLE_MORCEAU_DETERMINISTE), peu importe le nombre de fils. Le rsultat est donc
+ *   identique d'une excution  l'autre et d'une machine  l'autre (pour un mme jeu d'instructions, voir Noyaux.h).
+ * - Mode rapide (par dfaut): on fait quelques morceaux par fil, ce qui rduit le cot de coordination, mais le dcoupage (et donc l'arrondi du
+ *   rsultat) dpend du nombre de fils de la machine.
+ * Les oprations lment par lment donnent toujours exactement le mme rsultat qu'en squentiel.
+ */
+struct PolitiqueExecution
+{
+    enum Mode
+    {
+        SEQUENTIELLE,
+        PARALLELE
+    };
+
+    static const size_t SEUIL_PAR_DEFAUT = 1 << 16;
+    static const size_t TAILLE_MORCEAU_DETERMINISTE = 1 << 14;
+
+    Mode mode;
+    size_t seuil;
+    bool deterministe;
+
+    static PolitiqueExecution sequentielle();
+    static PolitiqueExecution parallele(const size_t _seuil = SEUIL_PAR_DEFAUT, const bool _deterministe = false);
+
+    bool doitParalleliser(const size_t _dimension) const;
+};
+
+/** \brief Outils de dcoupage utiliss par Vecteur pour appliquer une politique d'excution.
+ */
+namespace Parallele
+{
+    /** \brief Dcoupe l'intervalle [0, _dimension) en morceaux contigus et appelle `_corps(debut, fin)` pour chacun, en parallle si la politique
+     * le demande (sinon, un seul appel `_corps(0, _dimension)` sur le fil courant).
+     * `_elementsParUnite` indique combien d'lments (doubles) chaque unit de l'intervalle reprsente: par exemple, pour rpartir les lignes d'un
+     * VecteurBatch, une unit est une ligne de `dimension` lments. Le seuil et la taille des morceaux restent ainsi exprims en lments.
+     */
+    void pourChaqueMorceau(const size_t _dimension, const PolitiqueExecution & _politique, const function<void(size_t, size_t)> & _corps,
+                           const size_t _elementsParUnite = 1);
+
+    /** \brief Rduction parallle: `_partiel(debut, fin)` calcule le rsultat d'un morceau, puis les rsultats sont combins dans l'ordre des
+     * morceaux avec `_combiner`. Sans paralllisme, retourne simplement `_partiel(0, _dimension)`.
+     */
+    double reduire(const size_t _dimension, const PolitiqueExecution & _politique, const function<double(size_t, size_t)> & _partiel,
+                   double (*_combiner)(double, double));
+}
+
+#endif // POLITIQUEEXECUTION_H
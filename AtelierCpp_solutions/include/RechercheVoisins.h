@@ -0,0 +1,114 @@
+#ifndef RECHERCHEVOISINS_H
+#define RECHERCHEVOISINS_H
+
+#include <vector>
+
+#include "PolitiqueExecution.h"
+#include "Vecteur.h"
+#include "VecteurBatch.h"
+
+using namespace std;
+
+/** \brief Rsultat d'une recherche: position du vecteur dans la collection et son score pour la requte (produit scalaire, cosinus ou distance L2,
+ * selon la mtrique).
+ */
+struct Voisin
+{
+    size_t index;
+    double score;
+};
+
+/** \brief Recherche exacte des k plus proches voisins d'une requte dans une collection de vecteurs de mme dimension (recherche  par force
+ * brute : on compare la requte  tous les vecteurs).
+ * - Les vecteurs sont copis dans un VecteurBatch (lignes contigus et alignes) et leurs normes sont calcules une seule fois,  la construction:
+ *   chaque comparaison ne cote ensuite qu'un produit scalaire (noyau SIMD `Noyaux::produitScalaire`), mme pour le cosinus et la distance L2
+ *   (||q - x||^2 = ||q||^2 - 2 q  x + ||x||^2).
+ * - Chaque morceau de la collection (un par fil, selon la politique d'excution) garde ses k meilleurs candidats dans un tas born: un candidat
+ *   moins bon que le pire des k ne cote qu'une comparaison. Les tas sont fusionns  la fin.
+ * - Pour plusieurs requtes  la fois (`chercher(const VecteurBatch &, ...)`), le parcours est fait par tuiles: un bloc de vecteurs assez petit
+ *   pour rester dans la cache L2 est compar  un bloc de requtes avant de passer au suivant. Chaque vecteur n'est lu qu'une fois depuis la
+ *   mmoire principale par bloc de requtes, au lieu d'une fois par requte.
+ * Les rsultats sont tris du meilleur au moins bon;  score gal, le plus petit index passe en premier. Ils ne dpendent donc pas du nombre de
+ * fils. Pour la distance L2, le score des k voisins retenus est recalcul directement (`Noyaux::distanceCarree`), sans l'annulation de
+ * ||q||^2 - 2 q  x + ||x||^2 quand la requte est trs proche d'un vecteur. Un vecteur dont le score est NaN (il contient un NaN) est class
+ * aprs tous les autres.
+ */
+class RechercheVoisins
+{
+    public:
+        /** \brief Mtrique de similarit. PRODUIT_SCALAIRE et COSINUS: plus le score est grand, meilleur c'est. L2: distance euclidienne, plus
+         * elle est petite, meilleur c'est. Le cosinus avec un vecteur nul vaut 0.
+         */
+        enum Metrique
+        {
+            PRODUIT_SCALAIRE,
+            COSINUS,
+            L2
+        };
+
+        RechercheVoisins(const VecteurBatch & _vecteurs, const Metrique _metrique);
+        RechercheVoisins(VecteurBatch && _vecteurs, const Metrique _metrique);
+        RechercheVoisins(const vector<Vecteur> & _vecteurs, const Metrique _metrique);
+
+        vector<Voisin> chercher(const Vecteur & _requete, const size_t _k,
+                                const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        vector<vector<Voisin> > chercher(const VecteurBatch & _requetes, const size_t _k,
+                                         const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+
+        // Mthodes utilitaires
+        size_t getNombreVecteurs() const;
+        size_t getDimension() const;
+        Metrique getMetrique() const;
+        const VecteurBatch & getVecteurs() const;
+
+    private:
+        void preparer();
+        void verifierDimension(const size_t _dimension) const;
+
+        VecteurBatch vecteurs;
+        vector<double> normes;
+        Metrique metrique;
+};
+
+/** \brief Index approximatif  listes inverses (IVF,  inverted file ), pour les collections trop grandes pour la recherche exacte  chaque
+ * requte.  la construction, les vecteurs sont regroups en `_nombreListes` groupes par k-moyennes (k-means), et rangs de faon contigu, groupe
+ * par groupe. Une requte n'est ensuite compare qu'aux centres des groupes, puis aux vecteurs des `_nombreSondes` groupes les plus proches:
+ * avec sqrt(n) listes et quelques sondes, on lit quelques pour cent de la collection au lieu de sa totalit.
+ *
+ * C'est un compromis: un vrai voisin rang dans un groupe qui n'est pas sond est manqu. Le rappel (fraction des k vrais voisins retrouvs)
+ * augmente avec le nombre de sondes; avec `_nombreSondes == getNombreListes()`, le rsultat est celui de la recherche exacte. Les scores retourns
+ * sont exacts (mme dfinition que RechercheVoisins); seule la liste des candidats est approximative.
+ *
+ * Dtails de l'entranement: on part de `_nombreListes` vecteurs tirs au hasard (gnrateur initialis par `_graine`: l'index est reproductible),
+ * puis chaque itration assigne les vecteurs au centre le plus proche (distance L2) et remplace chaque centre par la moyenne de son groupe. Un
+ * groupe vide garde son centre. Au-del de 256 vecteurs par liste, l'entranement se fait sur un chantillon de cette taille. Pour COSINUS, les
+ * vecteurs et les centres sont normaliss (k-moyennes sphriques); pour PRODUIT_SCALAIRE, les groupes sonds sont ceux dont le centre a le plus
+ * grand produit scalaire avec la requte.
+ */
+class IndexIVF
+{
+    public:
+        IndexIVF(const VecteurBatch & _vecteurs, const RechercheVoisins::Metrique _metrique, const size_t _nombreListes,
+                 const size_t _iterations = 10, const unsigned _graine = 1,
+                 const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle());
+
+        vector<Voisin> chercher(const Vecteur & _requete, const size_t _k, const size_t _nombreSondes = 1) const;
+
+        // Mthodes utilitaires
+        size_t getNombreVecteurs() const;
+        size_t getDimension() const;
+        size_t getNombreListes() const;
+        size_t getTailleListe(const size_t _liste) const;
+        RechercheVoisins::Metrique getMetrique() const;
+
+    private:
+        RechercheVoisins::Metrique metrique;
+        VecteurBatch centres;
+        vector<double> normesCentres;
+        VecteurBatch vecteurs;
+        vector<double> normes;
+        vector<size_t> indices;
+        vector<size_t> debutsListes;
+};
+
+#endif // RECHERCHEVOISINS_H
@@ -0,0 +1,58 @@
+#ifndef RESERVOIRTACHES_H
+#define RESERVOIRTACHES_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/** \brief Rservoir de fils d'excution (thread pool) avec vol de tches (work stealing).
+ * Chaque travailleur possde sa propre file de tches. Il prend ses tches  l'arrire de sa file (les plus rcentes, encore chaudes dans la cache)
+ * et, quand sa file est vide, il en  vole   l'avant de la file des autres travailleurs. Ainsi, la charge se rquilibre toute seule quand
+ * certains morceaux de travail prennent plus de temps que d'autres.
+ * Un fil qui attend la fin d'un `paralleliser(...)` ne dort pas: il excute lui aussi des tches en attendant. On peut donc imbriquer les appels
+ * sans risque d'interblocage.
+ */
+class ReservoirTaches
+{
+    public:
+        explicit ReservoirTaches(const size_t _nombreTravailleurs);
+        ~ReservoirTaches();
+
+        ReservoirTaches(const ReservoirTaches &) = delete;
+        ReservoirTaches & operator=(const ReservoirTaches &) = delete;
+
+        static ReservoirTaches & global();
+        static ReservoirTaches & entreesSorties();
+
+        size_t getNombreTravailleurs() const;
+        void soumettre(function<void()> _tache);
+        void paralleliser(const size_t _nombreMorceaux, const function<void(size_t)> & _corps);
+        bool aider();
+
+    private:
+        struct FileTravailleur
+        {
+            mutex verrou;
+            deque<function<void()> > taches;
+        };
+
+        bool executerUneTache(const size_t _indexPrefere);
+        void boucleTravailleur(const size_t _index);
+
+        vector<unique_ptr<FileTravailleur> > files;
+        vector<thread> travailleurs;
+        atomic<size_t> tachesEnAttente;
+        atomic<size_t> prochaineFile;
+        mutex verrouSommeil;
+        condition_variable reveil;
+        bool arret;
+};
+
+#endif // RESERVOIRTACHES_H
@@ -0,0 +1,67 @@
+#ifndef TEXTEVECTEUR_H
+#define TEXTEVECTEUR_H
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "VueVecteur.h"
+
+using namespace std;
+
+/** \brief Format texte des Vecteurs: `[a\tb\tc]` (crochets, lments spars par des tabulations), celui de `Vecteur::toString()`.
+ * Chaque lment est crit avec `to_chars`: la plus courte reprsentation qui, relue, redonne exactement le mme double (aucune perte de
+ * prcision, contrairement aux 6 chiffres par dfaut d'un ostream), sans dpendre de la locale. La lecture utilise `from_chars`.
+ * L'criture se fait par morceaux dans un tampon fourni par l'appelant, sans jamais construire de chane complte: un Vecteur de plusieurs Go
+ * peut tre crit dans un fichier avec un tampon de quelques ko. La lecture accepte n'importe quel blanc (espace, tabulation, fin de ligne)
+ * comme sparateur; un texte mal form lance une `runtime_error`.
+ */
+namespace TexteVecteur
+{
+    /** \brief Taille minimale du tampon d'criture: assez pour n'importe quel lment (au plus 24 caractres) et son sparateur.
+     */
+    const size_t TAILLE_MINIMALE_TAMPON = 32;
+
+    /** \brief Nombre maximal de caractres ncessaires pour crire un Vecteur de dimension donne (taille d'un tampon qui reoit tout le texte).
+     */
+    size_t tailleMaximale(const size_t _dimension);
+
+    /** \brief crit les lments dans `_tampon` et appelle `_vider(debut, taille)` chaque fois qu'il est plein, puis une dernire fois  la fin.
+     * \param _vecteur: lments  crire (un Vecteur se convertit avec `vue()`).
+     * \param _tampon: tampon de l'appelant.
+     * \param _tailleTampon: taille du tampon, au moins TAILLE_MINIMALE_TAMPON.
+     * \param _vider: reoit chaque morceau de texte crit.
+     */
+    void formater(const VecteurVueConst & _vecteur, char * _tampon, const size_t _tailleTampon,
+                  const function<void(const char *, size_t)> & _vider);
+
+    /** \brief crit le texte directement dans un descripteur de fichier (POSIX `write`), par morceaux de 64 ko.
+     */
+    void ecrire(const VecteurVueConst & _vecteur, const int _descripteur);
+
+    /** \brief crit le texte dans un flux (par exemple `cout` ou un `ofstream`), par morceaux de 64 ko.
+     */
+    void ecrire(const VecteurVueConst & _vecteur, ostream & _sortie);
+
+    /** \brief Lit le format `[a\tb\tc]` par morceaux: `_lire(tampon, taille)` remplit le tampon et retourne le nombre de caractres lus (0  la fin).
+     * Les lments sont ajouts  `_valeurs` (vid au dpart).
+     */
+    void analyser(const function<size_t(char *, size_t)> & _lire, pmr::vector<double> & _valeurs);
+
+    /** \brief Lit un texte complet dj en mmoire (par exemple le rsultat de `toString()`).
+     */
+    void analyser(const char * _debut, const char * _fin, pmr::vector<double> & _valeurs);
+
+    /** \brief Lit le texte d'un descripteur de fichier (POSIX `read`) jusqu' la fin.
+     */
+    void analyser(const int _descripteur, pmr::vector<double> & _valeurs);
+
+    /** \brief Lit le texte d'un flux jusqu'au crochet fermant.
+     */
+    void analyser(istream & _entree, pmr::vector<double> & _valeurs);
+}
+
+#endif // TEXTEVECTEUR_H
@@ -6,56 +6,299 @@
 #include <sstream>
 #include <iostream>
 #include <cmath>
+#include <memory_resource>
+
+#include "InstrumentationVecteur.h"
+#include "MemoireVecteur.h"
+#include "PolitiqueExecution.h"
+#include "VecteurExpression.h"
+#include "VueVecteur.h"
 
 using namespace std;
 
-class Vecteur
+class Vecteur : public ExpressionVecteur<Vecteur>
 {
     public:
         // Constructeurs + destructeur + assignation + accesseur
         virtual ~Vecteur();
         Vecteur(const Vecteur & _autre);
-        Vecteur(const vector<double> & _valeurs);
-        Vecteur(const size_t _dimension, const double _valeurInitiale);
+        Vecteur(const Vecteur & _autre, pmr::memory_resource * _ressource);
+        Vecteur(Vecteur && _autre) noexcept;
+        Vecteur(const vector<double> & _valeurs, pmr::memory_resource * _ressource = nullptr);
+        Vecteur(const size_t _dimension, const double _valeurInitiale, pmr::memory_resource * _ressource = nullptr);
         Vecteur(const double _start, const double _stop, const double _step);
+        Vecteur(const double _start, const double _stop, const double _step, const PolitiqueExecution & _politique);
+        Vecteur(const ExpressionIntervalle & _intervalle, const PolitiqueExecution & _politique);
+        explicit Vecteur(istream & _entree, pmr::memory_resource * _ressource = nullptr);
+        template <typename E>
+        Vecteur(const ExpressionVecteur<E> & _expression);
         Vecteur& operator=(const Vecteur & _autre);
+        Vecteur& operator=(Vecteur && _autre);
+        template <typename E>
+        Vecteur& operator=(const ExpressionVecteur<E> & _expression);
+        double evaluer(const size_t _index) const { return vecteurInterne[_index]; }
+        bool chevauche(const double * _donnees, const size_t _dimension, const size_t _pas) const {
+            return chevaucheMemoire(vecteurInterne.data(), dimension, 1, _donnees, _dimension, _pas);
+        }
+
+        // Accs aux lments (`operator[]` vrifie l'index seulement sans NDEBUG, `at` le vrifie toujours)
+        typedef double * iterator;
+        typedef const double * const_iterator;
         double & operator[](const size_t _index);
+        const double & operator[](const size_t _index) const;
+        double & at(const size_t _index);
+        const double & at(const size_t _index) const;
+        double * data() { return vecteurInterne.data(); }
+        const double * data() const { return vecteurInterne.data(); }
+        iterator begin() { return vecteurInterne.data(); }
+        iterator end() { return vecteurInterne.data() + dimension; }
+        const_iterator begin() const { return vecteurInterne.data(); }
+        const_iterator end() const { return vecteurInterne.data() + dimension; }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        static Vecteur espaceLineaire(const double _debut, const double _fin, const size_t _nombre, const bool _inclureFin = true);
+        static Vecteur espaceLineaire(const double _debut, const double _fin, const size_t _nombre, const PolitiqueExecution & _politique,
+                                      const bool _inclureFin = true);
 
-        // Mathmatiques vecteur avec vecteur
-        Vecteur operator+(const Vecteur & _autre);
+        // Mathmatiques vecteur avec vecteur (`+` et `-` sont paresseux, voir VecteurExpression.h)
         Vecteur & operator+=(const Vecteur & _autre);
-        Vecteur operator-(const Vecteur & _autre);
         Vecteur & operator-=(const Vecteur & _autre);
-        double operator*(const Vecteur & _autre);
+        template <typename E>
+        Vecteur & operator+=(const ExpressionVecteur<E> & _expression);
+        template <typename E>
+        Vecteur & operator-=(const ExpressionVecteur<E> & _expression);
+        double operator*(const Vecteur & _autre) const;
 
-        // Mathmatiques vecteur avec scalaire
-        Vecteur operator+(const double _autre);
+        // Mathmatiques vecteur avec scalaire (`+`, `-`, `*` et `/` sont paresseux, voir VecteurExpression.h)
         Vecteur & operator+=(const double _autre);
-        Vecteur operator-(const double _autre);
         Vecteur & operator-=(const double _autre);
-        Vecteur operator*(const double _autre);
         Vecteur & operator*=(const double _autre);
-        Vecteur operator/(const double _autre);
         Vecteur & operator/=(const double _autre);
 
+        // Vues sans copie (voir VueVecteur.h)
+        VecteurVue vue();
+        VecteurVueConst vue() const;
+        VecteurVue tranche(const size_t _debut, const size_t _fin, const size_t _pas = 1);
+        VecteurVueConst tranche(const size_t _debut, const size_t _fin, const size_t _pas = 1) const;
+
         // Mathmatiques autres
-        double dot(const Vecteur & _autre);
-        Vecteur cross(const Vecteur & _autre);
-        Vecteur exposant(const double _puissance);
-        double somme();
-        double prod();
-        double norme();
+        double dot(const Vecteur & _autre) const;
+        template <typename E>
+        double dot(const ExpressionVecteur<E> & _expression) const;
+        Vecteur cross(const Vecteur & _autre) const;
+        Vecteur exposant(const double _puissance) const;
+        Vecteur & exposantEnPlace(const double _puissance);
+        double somme() const;
+        double prod() const;
+        double norme() const;
+
+        // Niveau 1 de BLAS: oprations combines en un seul passage sur la mmoire, avec FMA (voir Noyaux::axpy)
+        Vecteur & axpy(const double _a, const Vecteur & _x);
+        Vecteur & axpby(const double _a, const Vecteur & _x, const double _b);
+        Vecteur & scal(const double _a);
+        double normaliser();
+        double dotEtNormes(const Vecteur & _autre, double & _normeCourant, double & _normeAutre) const;
+        double distance(const Vecteur & _autre) const;
+
+        // Mathmatiques avec politique d'excution (parallle au-del d'un seuil, voir PolitiqueExecution.h)
+        template <typename E>
+        Vecteur & assigner(const ExpressionVecteur<E> & _expression, const PolitiqueExecution & _politique);
+        double dot(const Vecteur & _autre, const PolitiqueExecution & _politique) const;
+        Vecteur exposant(const double _puissance, const PolitiqueExecution & _politique) const;
+        Vecteur & exposantEnPlace(const double _puissance, const PolitiqueExecution & _politique);
+        double somme(const PolitiqueExecution & _politique) const;
+        double prod(const PolitiqueExecution & _politique) const;
+        double norme(const PolitiqueExecution & _politique) const;
+        Vecteur & axpy(const double _a, const Vecteur & _x, const PolitiqueExecution & _politique);
+        Vecteur & axpby(const double _a, const Vecteur & _x, const double _b, const PolitiqueExecution & _politique);
+        double distance(const Vecteur & _autre, const PolitiqueExecution & _politique) const;
+
+        // Mathmatiques avec stratgie de rduction (compromis vitesse/prcision, voir Noyaux::Reduction)
+        double dot(const Vecteur & _autre, const Noyaux::Reduction _reduction) const;
+        double somme(const Noyaux::Reduction _reduction) const;
+        double prod(const Noyaux::Reduction _reduction) const;
+        double norme(const Noyaux::Reduction _reduction) const;
+        double logProd(int * _signe = nullptr) const;
 
         // Mthodes utilitaires
-        size_t getDimension();
-        string toString();
-        void afficher();
+        size_t getDimension() const;
+        pmr::memory_resource * getRessourceMemoire() const;
+        string toString() const;
+        void afficher() const;
 
     protected:
 
     private:
-        vector<double> vecteurInterne;
+        pmr::vector<double> vecteurInterne;
         size_t dimension;
 };
 
+/** \brief Oprateur [<arguments>] qui permet d'indexer le Vecteur courant (un peu comme en Python avec les listes, etc.). En plus de donner la valeur
+ *  un certain index, on peut aussi modifier cette valeur (d'o le retour par rfrence). L'index doit tre strictement plus petit que la dimension.
+ * Sans NDEBUG (compilation Debug), l'index est vrifi et une erreur est lance s'il est en-dehors du vecteur. Avec NDEBUG (compilation Release),
+ * il ne l'est pas: une boucle sur `v[i]` n'a plus de branchement et peut tre vectorise. Pour toujours vrifier l'index, utiliser `at(...)`.
+ * \param _index: de type size_t, index de l'lment qu'on veut accder.
+ * \return la rfrence vers la valeur contenue  l'index donn. Ainsi, on peut non seulement accder  cette valeur, mais aussi la modifier.
+ */
+inline double & Vecteur::operator[](const size_t _index){
+#ifndef NDEBUG
+    return at(_index);
+#else
+    return vecteurInterne[_index];
+#endif
+}
+
+/** \brief Variante constante de `operator[]` (lecture seule), avec la mme vrification.
+ * \param _index: index de l'lment qu'on veut lire.
+ * \return une rfrence constante vers l'lment.
+ */
+inline const double & Vecteur::operator[](const size_t _index) const {
+#ifndef NDEBUG
+    return at(_index);
+#else
+    return vecteurInterne[_index];
+#endif
+}
+
+/** \brief Accs vrifi: lance une erreur si l'index est en-dehors du vecteur, peu importe la compilation.
+ * \param _index: index de l'lment qu'on veut accder. Doit tre strictement plus petit que la dimension du vecteur.
+ * \return la rfrence vers l'lment.
+ */
+inline double & Vecteur::at(const size_t _index){
+    if (_index >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return vecteurInterne[_index];
+}
+
+/** \brief Variante constante de `at(...)`.
+ * \param _index: index de l'lment qu'on veut lire. Doit tre strictement plus petit que la dimension du vecteur.
+ * \return une rfrence constante vers l'lment.
+ */
+inline const double & Vecteur::at(const size_t _index) const {
+    if (_index >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return vecteurInterne[_index];
+}
+
+/** \brief Constructeur  partir d'une expression paresseuse (par exemple `Vecteur r = a + b * 2.0 - c;`).
+ * C'est ici que l'expression est rellement calcule: une seule allocation (dans la ressource mmoire courante du fil, voir MemoireVecteur.h) et
+ * une seule boucle sur les lments, peu importe le nombre d'oprateurs.
+ * \param _expression: expression vectorielle  valuer.
+ */
+template <typename E>
+Vecteur::Vecteur(const ExpressionVecteur<E> & _expression)
+    : vecteurInterne(PorteeMemoire::ressourceCourante())
+{
+    const E & expression = _expression.derivee();
+    dimension = expression.getDimension();
+    INSTRUMENTER_VECTEUR(EVALUATION_EXPRESSION, dimension, 1, dimension * sizeof(double));
+    vecteurInterne.assign(IterateurExpression<E>(expression, 0), IterateurExpression<E>(expression, dimension));
+}
+
+/** \brief Oprateur d'assignation  partir d'une expression paresseuse (par exemple `r = a + b;`).
+ * Si le Vecteur courant a dj la bonne dimension, on crit directement dans sa mmoire, sans aucune allocation. a reste valide mme si le Vecteur
+ * courant fait partie de l'expression (`a = a + b`), car l'lment `i` du rsultat ne dpend que des lments `i` des oprandes.
+ * \param _expression: expression vectorielle  valuer.
+ * \return *this, le pointeur de l'objet courant drfrenc.
+ */
+template <typename E>
+Vecteur & Vecteur::operator=(const ExpressionVecteur<E> & _expression){
+    const E & expression = _expression.derivee();
+    const size_t nouvelleDimension = expression.getDimension();
+    INSTRUMENTER_VECTEUR(ASSIGNATION_EXPRESSION, nouvelleDimension, vecteurInterne.capacity() < nouvelleDimension ? 1 : 0, 0);
+    vecteurInterne.assign(IterateurExpression<E>(expression, 0), IterateurExpression<E>(expression, nouvelleDimension));
+    dimension = nouvelleDimension;
+    return *this;
+}
+
+/** \brief Oprateur `+=` avec une expression paresseuse (par exemple `accumulateur += x * poids;`).
+ * L'expression est value lment par lment directement dans la mmoire de l'objet courant: aucune allocation, un seul passage.
+ * \param _expression: expression  additionner. Doit tre de mme dimension que l'objet courant.
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+template <typename E>
+Vecteur & Vecteur::operator+=(const ExpressionVecteur<E> & _expression){
+    const E & expression = _expression.derivee();
+    if (dimension != expression.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    INSTRUMENTER_VECTEUR(AJOUTER, dimension, 0, 0);
+    for (size_t i = 0; i < dimension; i++){
+        vecteurInterne[i] += expression.evaluer(i);
+    }
+    return *this;
+}
+
+/** \brief Oprateur `-=` avec une expression paresseuse. Mme logique que `+=`, en soustrayant.
+ * \param _expression: expression  soustraire. Doit tre de mme dimension que l'objet courant.
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+template <typename E>
+Vecteur & Vecteur::operator-=(const ExpressionVecteur<E> & _expression){
+    const E & expression = _expression.derivee();
+    if (dimension != expression.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    INSTRUMENTER_VECTEUR(SOUSTRAIRE, dimension, 0, 0);
+    for (size_t i = 0; i < dimension; i++){
+        vecteurInterne[i] -= expression.evaluer(i);
+    }
+    return *this;
+}
+
+/** \brief Produit scalaire avec une expression ou une vue (par exemple `v.dot(batch.vueLigne(i))` ou `v.dot(a - b)`), sans Vecteur intermdiaire.
+ * Avec une vue contigu, le calcul passe par le mme noyau SIMD que `dot(const Vecteur &)`.
+ * \param _expression: expression avec laquelle faire le produit scalaire. Doit tre de mme dimension que l'objet courant.
+ * \return le produit scalaire (un double).
+ */
+template <typename E>
+double Vecteur::dot(const ExpressionVecteur<E> & _expression) const {
+    INSTRUMENTER_VECTEUR(DOT, dimension, 0, 0);
+    return vue().dot(_expression.derivee());
+}
+
+/** \brief value une expression paresseuse dans le Vecteur courant selon une politique d'excution, par exemple
+ * `r.assigner(a + b * 2.0, PolitiqueExecution::parallele());`. Au-del du seuil de la politique, chaque fil value un morceau contigu de
+ * l'expression. Le rsultat est toujours identique  `r = a + b * 2.0;`, mme si l'expression lit d'autres lments de `r` (par exemple
+ * `r.assigner(r.tranche(1, n), ...)`): elle est alors value dans une nouvelle mmoire, qui remplace ensuite celle de `r`.
+ * \param _expression: expression vectorielle  valuer.
+ * \param _politique: politique d'excution.
+ * \return *this, le pointeur de l'objet courant drfrenc.
+ */
+template <typename E>
+Vecteur & Vecteur::assigner(const ExpressionVecteur<E> & _expression, const PolitiqueExecution & _politique){
+    const E & expression = _expression.derivee();
+    const size_t nouvelleDimension = expression.getDimension();
+    if (!_politique.doitParalleliser(nouvelleDimension)){
+        return (*this) = _expression;
+    }
+    const auto evaluerMorceaux = [&expression, &_politique, nouvelleDimension](double * _donnees){
+        Parallele::pourChaqueMorceau(nouvelleDimension, _politique, [&expression, _donnees](const size_t _debut, const size_t _fin){
+            for (size_t i = _debut; i < _fin; i++){
+                _donnees[i] = expression.evaluer(i);
+            }
+        });
+    };
+    if (expression.chevauche(vecteurInterne.data(), dimension, 1)){
+        // Un morceau pourrait lire un lment qu'un autre morceau a dj crit: on crit dans une mmoire  part (mme ressource mmoire).
+        INSTRUMENTER_VECTEUR(ASSIGNATION_EXPRESSION, nouvelleDimension, 1, nouvelleDimension * sizeof(double));
+        pmr::vector<double> resultat(nouvelleDimension, vecteurInterne.get_allocator());
+        evaluerMorceaux(resultat.data());
+        vecteurInterne.swap(resultat);
+        dimension = nouvelleDimension;
+        return *this;
+    }
+    INSTRUMENTER_VECTEUR(ASSIGNATION_EXPRESSION, nouvelleDimension, nouvelleDimension != dimension ? 1 : 0, 0);
+    if (nouvelleDimension != dimension){
+        // L'expression ne lit pas le Vecteur courant (sinon, elle chevaucherait): on peut le redimensionner sans risque.
+        vecteurInterne.resize(nouvelleDimension);
+        dimension = nouvelleDimension;
+    }
+    evaluerMorceaux(vecteurInterne.data());
+    return *this;
+}
+
 #endif // VECTEUR_H
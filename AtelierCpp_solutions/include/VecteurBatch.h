@@ -0,0 +1,79 @@
+#ifndef VECTEURBATCH_H
+#define VECTEURBATCH_H
+
+#include <vector>
+
+#include "Vecteur.h"
+#include "PolitiqueExecution.h"
+
+using namespace std;
+
+/** \brief Lot de N vecteurs de mme dimension, stocks de faon contigu dans un seul bloc de mmoire align (une  matrice  N x dimension).
+ * Quand on garde des dizaines de milliers de petits Vecteurs, chacun a sa propre allocation sur le tas: parcourir la collection saute d'un endroit
+ * de la mmoire  l'autre (pointer chasing) et rate la cache. Ici, les lignes se suivent en mmoire; chaque ligne commence sur une frontire de
+ * 64 octets (une ligne de cache), grce  un pas (`getPas()`) arrondi au multiple de 8 doubles suprieur. Les lments de remplissage valent 0.
+ * Les oprations en lot (produit scalaire d'une requte avec toutes les lignes, normes, matrice des produits scalaires, etc.) se font en un seul
+ * appel et peuvent tre paralllises avec une PolitiqueExecution. `data()` donne le dbut du bloc: la ligne i commence  `data() + i * getPas()`.
+ */
+class VecteurBatch
+{
+    public:
+        static const size_t ALIGNEMENT = 64;
+
+        // Constructeurs + destructeur + assignation
+        VecteurBatch(const size_t _nombreLignes, const size_t _dimension, const double _valeurInitiale = 0);
+        VecteurBatch(const vector<Vecteur> & _vecteurs);
+        VecteurBatch(const VecteurBatch & _autre);
+        VecteurBatch(VecteurBatch && _autre) noexcept;
+        ~VecteurBatch();
+        VecteurBatch & operator=(const VecteurBatch & _autre);
+        VecteurBatch & operator=(VecteurBatch && _autre) noexcept;
+
+        // Accs aux lignes et aux lments
+        double * data() { return donnees; }
+        const double * data() const { return donnees; }
+        double * ligne(const size_t _ligne);
+        const double * ligne(const size_t _ligne) const;
+        double & operator()(const size_t _ligne, const size_t _colonne);
+        double operator()(const size_t _ligne, const size_t _colonne) const;
+        Vecteur extraire(const size_t _ligne) const;
+        VecteurVue vueLigne(const size_t _ligne);
+        VecteurVueConst vueLigne(const size_t _ligne) const;
+        VecteurVue vueColonne(const size_t _colonne);
+        VecteurVueConst vueColonne(const size_t _colonne) const;
+        void definir(const size_t _ligne, const Vecteur & _valeurs);
+
+        // Mathmatiques en lot
+        Vecteur dot(const Vecteur & _requete, const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        Vecteur normes(const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        VecteurBatch produitsScalaires(const VecteurBatch & _autre,
+                                       const PolitiqueExecution & _politique = PolitiqueExecution::sequentielle()) const;
+        VecteurBatch cross(const Vecteur & _autre) const;
+        VecteurBatch cross(const VecteurBatch & _autre) const;
+
+        // Mathmatiques lment par lment, en place
+        VecteurBatch & operator+=(const VecteurBatch & _autre);
+        VecteurBatch & operator-=(const VecteurBatch & _autre);
+        VecteurBatch & operator+=(const Vecteur & _autre);
+        VecteurBatch & operator-=(const Vecteur & _autre);
+        VecteurBatch & operator*=(const double _autre);
+        VecteurBatch & operator/=(const double _autre);
+
+        // Mthodes utilitaires
+        size_t getNombreLignes() const;
+        size_t getDimension() const;
+        size_t getPas() const;
+
+    private:
+        void allouer(const size_t _nombreLignes, const size_t _dimension);
+        void liberer();
+        void verifierMemeForme(const VecteurBatch & _autre) const;
+        void verifierDimension(const Vecteur & _autre) const;
+
+        double * donnees;
+        size_t nombreLignes;
+        size_t dimension;
+        size_t pas;
+};
+
+#endif // VECTEURBATCH_H
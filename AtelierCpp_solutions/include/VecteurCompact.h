@@ -0,0 +1,207 @@
+#ifndef VECTEURCOMPACT_H
+#define VECTEURCOMPACT_H
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include "Noyaux.h"
+#include "Vecteur.h"
+#include "VecteurExpression.h"
+#include "VueVecteur.h"
+
+using namespace std;
+
+/** \brief Nombre  virgule flottante de 16 bits  bfloat16 : les 16 bits de poids fort d'un float (mme exposant, 7 bits de mantisse au lieu
+ * de 23, soit environ 3 chiffres significatifs). La conversion depuis un double arrondit au plus proche ( galit, vers le pair).
+ */
+struct Bfloat16
+{
+    uint16_t bits;
+
+    static Bfloat16 depuisDouble(const double _valeur){
+        const float flottant = float(_valeur);
+        uint32_t bitsFlottant;
+        memcpy(&bitsFlottant, &flottant, sizeof(bitsFlottant));
+        Bfloat16 retour;
+        if (flottant != flottant){
+            retour.bits = uint16_t((bitsFlottant >> 16) | 0x0040); // NaN reste NaN (mme si sa mantisse tronque serait nulle).
+            return retour;
+        }
+        bitsFlottant += 0x7FFF + ((bitsFlottant >> 16) & 1);
+        retour.bits = uint16_t(bitsFlottant >> 16);
+        return retour;
+    }
+
+    double versDouble() const {
+        const uint32_t bitsFlottant = uint32_t(bits) << 16;
+        float flottant;
+        memcpy(&flottant, &bitsFlottant, sizeof(flottant));
+        return flottant;
+    }
+};
+
+/** \brief Description d'un type d'lment compact: conversion depuis et vers double, et noyaux de rduction (voir Noyaux.h).
+ * Pour les types quantifis (int8), chaque lment reprsente `valeur * echelle`, o l'chelle est propre  chaque vecteur.
+ */
+template <typename T>
+struct FormatCompact;
+
+template <>
+struct FormatCompact<float>
+{
+    static const bool QUANTIFIE = false;
+    static float encoder(const double _valeur, const double) { return float(_valeur); }
+    static double decoder(const float _element) { return _element; }
+    static double produitScalaire(const float * _a, const float * _b, const size_t _n) { return Noyaux::produitScalaire(_a, _b, _n); }
+    static double somme(const float * _a, const size_t _n) { return Noyaux::somme(_a, _n); }
+    static double sommeCarres(const float * _a, const size_t _n) { return Noyaux::sommeCarres(_a, _n); }
+};
+
+template <>
+struct FormatCompact<Bfloat16>
+{
+    static const bool QUANTIFIE = false;
+    static Bfloat16 encoder(const double _valeur, const double) { return Bfloat16::depuisDouble(_valeur); }
+    static double decoder(const Bfloat16 _element) { return _element.versDouble(); }
+    static double produitScalaire(const Bfloat16 * _a, const Bfloat16 * _b, const size_t _n) {
+        return Noyaux::produitScalaireBfloat16(&_a->bits, &_b->bits, _n);
+    }
+    static double somme(const Bfloat16 * _a, const size_t _n) { return Noyaux::sommeBfloat16(&_a->bits, _n); }
+    static double sommeCarres(const Bfloat16 * _a, const size_t _n) { return Noyaux::sommeCarresBfloat16(&_a->bits, _n); }
+};
+
+template <>
+struct FormatCompact<int8_t>
+{
+    static const bool QUANTIFIE = true;
+    static int8_t encoder(const double _valeur, const double _echelle) {
+        const double quantifiee = nearbyint(_valeur / _echelle);
+        return int8_t(quantifiee > 127 ? 127 : (quantifiee < -127 ? -127 : quantifiee));
+    }
+    static double decoder(const int8_t _element) { return _element; }
+    static double produitScalaire(const int8_t * _a, const int8_t * _b, const size_t _n) { return double(Noyaux::produitScalaire(_a, _b, _n)); }
+    static double somme(const int8_t * _a, const size_t _n) { return double(Noyaux::somme(_a, _n)); }
+    static double sommeCarres(const int8_t * _a, const size_t _n) { return double(Noyaux::sommeCarres(_a, _n)); }
+};
+
+/** \brief Vecteur en lecture seule dont les lments sont stocks dans un type plus petit que double: float (4 octets), Bfloat16 (2 octets) ou
+ * int8_t quantifi (1 octet, avec une chelle par vecteur). La mmoire, et donc le dbit mmoire ncessaire pour la parcourir, est divis par 2,
+ * 4 ou 8: pour les calculs limits par la mmoire (produits scalaires sur de gros lots de vecteurs), c'est autant de gagn en vitesse.
+ *
+ * Seul le stockage perd de la prcision ( la conversion). Les calculs, eux, accumulent en plus haute prcision: `dot`, `somme` et `norme`
+ * convertissent chaque lment en double (sans perte) et accumulent en double; en int8, ils accumulent en entiers (exact), puis appliquent
+ * l'chelle. Prcision du stockage (erreur relative par lment): float ~6e-8, Bfloat16 ~4e-3; en int8, l'erreur absolue par lment est au plus
+ * `echelle / 2`, avec `echelle = max|x| / 127`. Les infinis et NaN restent tels quels en float et en Bfloat16; en int8, ils ne sont pas
+ * reprsentables et la construction lance une `runtime_error`.
+ *
+ * Vecteur, lui, reste en double partout: VecteurCompact sert de format de stockage (par exemple pour une collection de vecteurs  comparer).
+ * C'est une expression vectorielle (voir VecteurExpression.h): `Vecteur v = compact;` le dcompresse, et il se mlange aux Vecteurs dans les
+ * expressions paresseuses.
+ */
+template <typename T>
+class VecteurCompact : public ExpressionVecteur<VecteurCompact<T> >
+{
+    public:
+        // Constructeurs
+        explicit VecteurCompact(const Vecteur & _source) : dimension(0), echelle(1) {
+            construire(_source.vue());
+        }
+
+        template <typename U>
+        explicit VecteurCompact(const VueVecteur<U> & _source) : dimension(0), echelle(1) {
+            construire(VecteurVueConst(_source));
+        }
+
+        VecteurCompact(const size_t _dimension, const double _valeurInitiale) : dimension(0), echelle(1) {
+            const vector<double> valeursInitiales(_dimension, _valeurInitiale);
+            construire(VecteurVueConst(valeursInitiales));
+        }
+
+        // Conversion
+        Vecteur versVecteur() const {
+            return Vecteur(*this);
+        }
+
+        // Accs (lecture seule)
+        double operator[](const size_t _index) const {
+            if (_index >= dimension){
+                throw runtime_error("L'index est en-dehors du vecteur.");
+            }
+            return evaluer(_index);
+        }
+
+        double evaluer(const size_t _index) const {
+            return FormatCompact<T>::decoder(elements[_index]) * echelle;
+        }
+
+        // Mathmatiques (accumulation en double ou en entiers, voir Noyaux.h)
+        using ExpressionVecteur<VecteurCompact<T> >::dot;
+
+        double dot(const VecteurCompact & _autre) const {
+            if (dimension != _autre.dimension){
+                throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+            }
+            return FormatCompact<T>::produitScalaire(elements.data(), _autre.elements.data(), dimension) * (echelle * _autre.echelle);
+        }
+
+        double somme() const {
+            return FormatCompact<T>::somme(elements.data(), dimension) * echelle;
+        }
+
+        double norme() const {
+            return sqrt(FormatCompact<T>::sommeCarres(elements.data(), dimension)) * echelle;
+        }
+
+        // Mthodes utilitaires
+        size_t getDimension() const { return dimension; }
+        double getEchelle() const { return echelle; }
+        const T * getDonnees() const { return elements.data(); }
+        size_t getTailleOctets() const { return dimension * sizeof(T); }
+
+    private:
+        void construire(const VecteurVueConst & _source){
+            dimension = _source.getDimension();
+            echelle = 1;
+            if (FormatCompact<T>::QUANTIFIE){
+                // Un entier ne reprsente ni l'infini ni NaN (et `int8_t(NaN)` serait un comportement indfini): on les refuse, plutt que
+                // de laisser un infini rendre l'chelle infinie (tous les lments redonneraient NaN).
+                double maximum = 0;
+                for (size_t i = 0; i < dimension; i++){
+                    const double absolue = fabs(_source.evaluer(i));
+                    if (!(absolue <= DBL_MAX)){
+                        throw runtime_error("Un vecteur quantifi en int8 ne peut pas contenir d'infini ni de NaN.");
+                    }
+                    maximum = max(maximum, absolue);
+                }
+                if (maximum > 0){
+                    echelle = max(maximum / 127, DBL_TRUE_MIN); // maximum / 127 peut tre arrondi  0 pour un maximum sous-normal.
+                }
+            }
+            elements.resize(dimension);
+            for (size_t i = 0; i < dimension; i++){
+                elements[i] = FormatCompact<T>::encoder(_source.evaluer(i), echelle);
+            }
+        }
+
+        vector<T> elements;
+        size_t dimension;
+        double echelle;
+};
+
+/** \brief Un VecteurCompact est conserv par rfrence dans les expressions.
+ */
+template <typename T>
+struct StockageExpression<VecteurCompact<T> >
+{
+    typedef const VecteurCompact<T> & type;
+};
+
+typedef VecteurCompact<float> VecteurFloat;
+typedef VecteurCompact<Bfloat16> VecteurBfloat16;
+typedef VecteurCompact<int8_t> VecteurInt8;
+
+#endif // VECTEURCOMPACT_H
@@ -0,0 +1,134 @@
+#ifndef VECTEURCREUX_H
+#define VECTEURCREUX_H
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "Vecteur.h"
+#include "VecteurExpression.h"
+#include "VueVecteur.h"
+
+using namespace std;
+
+/** \brief Vecteur creux: seuls les lments non nuls sont stocks, dans deux tableaux tris par index (`indices` et `valeurs`).
+ * Pour un Vecteur de dimension n avec k lments non nuls, la mmoire et le temps de `dot`, `somme`, `norme` et de l'addition passent de O(n)
+ *  O(k): pour un vecteur de caractristiques de 10^6 dimensions avec quelques centaines de non-nuls, c'est des milliers de fois moins de travail.
+ * - creux  dense: on lit seulement les k lments du Vecteur dense aux index non nuls.
+ * - creux  creux: fusion des deux listes d'index tries (ou recherche dichotomique si l'une est beaucoup plus courte que l'autre).
+ * - creux + dense: copie du dense, puis ajout des k lments non nuls (le rsultat est dense).
+ * - creux + creux: fusion (le rsultat reste creux).
+ *
+ * VecteurCreux est aussi une expression vectorielle (voir VecteurExpression.h): `Vecteur r = a + creux * 2.0;` fonctionne, mais chaque accs
+ * `evaluer(i)` y cote une recherche dichotomique. Pour convertir en dense, `versDense()` est beaucoup plus rapide que `Vecteur v = creux;`.
+ * Pour laisser la reprsentation tre choisie automatiquement selon la densit, voir VecteurAdaptatif.
+ */
+class VecteurCreux : public ExpressionVecteur<VecteurCreux>
+{
+    public:
+        // Constructeurs
+        explicit VecteurCreux(const size_t _dimension = 0);
+        VecteurCreux(const size_t _dimension, const vector<size_t> & _indices, const vector<double> & _valeurs);
+        explicit VecteurCreux(const Vecteur & _dense, const double _seuil = 0);
+        template <typename T>
+        explicit VecteurCreux(const VueVecteur<T> & _dense, const double _seuil = 0) : dimension(0) {
+            construire(VecteurVueConst(_dense), _seuil);
+        }
+
+        // Conversion
+        Vecteur versDense() const;
+
+        // Accs
+        double operator[](const size_t _index) const;
+        double evaluer(const size_t _index) const;
+        void definir(const size_t _index, const double _valeur);
+
+        // Mathmatiques creux avec creux
+        VecteurCreux operator+(const VecteurCreux & _autre) const;
+        VecteurCreux operator-(const VecteurCreux & _autre) const;
+        double dot(const VecteurCreux & _autre) const;
+
+        // Mathmatiques creux avec dense
+        using ExpressionVecteur<VecteurCreux>::dot;
+        double dot(const Vecteur & _dense) const;
+        template <typename T>
+        double dot(const VueVecteur<T> & _dense) const {
+            return produitScalaireDense(VecteurVueConst(_dense));
+        }
+        void ajouterA(const VecteurVue & _dense, const double _facteur = 1) const;
+
+        // Mathmatiques avec scalaire
+        VecteurCreux & operator*=(const double _autre);
+        VecteurCreux & operator/=(const double _autre);
+
+        // Mathmatiques autres
+        double somme() const;
+        double norme() const;
+
+        // Mthodes utilitaires
+        size_t getDimension() const;
+        size_t getNombreNonNuls() const;
+        double getDensite() const;
+        const vector<size_t> & getIndices() const;
+        const vector<double> & getValeurs() const;
+
+    private:
+        void construire(const VecteurVueConst & _dense, const double _seuil);
+        double produitScalaireDense(const VecteurVueConst & _dense) const;
+        template <typename Op>
+        VecteurCreux fusionner(const VecteurCreux & _autre) const;
+
+        vector<size_t> indices;
+        vector<double> valeurs;
+        size_t dimension;
+};
+
+/** \brief Un VecteurCreux est conserv par rfrence dans les expressions (ses tableaux ne sont jamais copis).
+ */
+template <>
+struct StockageExpression<VecteurCreux>
+{
+    typedef const VecteurCreux & type;
+};
+
+// Mathmatiques creux avec dense (le rsultat est dense)
+Vecteur operator+(const Vecteur & _dense, const VecteurCreux & _creux);
+Vecteur operator+(const VecteurCreux & _creux, const Vecteur & _dense);
+Vecteur operator-(const Vecteur & _dense, const VecteurCreux & _creux);
+
+/** \brief Vecteur dont la reprsentation (dense ou creuse) est choisie automatiquement selon sa densit (proportion d'lments non nuls).
+ * Sous SEUIL_DENSITE, la forme creuse prend moins de mmoire (16 octets par non-nul contre 8 par lment) et ses calculs sont plus rapides malgr
+ * l'accs indirect; au-dessus, la forme dense et ses noyaux SIMD gagnent. Les oprations choisissent le meilleur calcul selon les deux formes, et
+ * le rsultat d'une addition est lui-mme reclass.
+ */
+class VecteurAdaptatif
+{
+    public:
+        static constexpr double SEUIL_DENSITE = 0.125;
+
+        // Constructeurs
+        explicit VecteurAdaptatif(const Vecteur & _dense);
+        explicit VecteurAdaptatif(const VecteurCreux & _creux);
+
+        // Mathmatiques
+        double dot(const VecteurAdaptatif & _autre) const;
+        VecteurAdaptatif operator+(const VecteurAdaptatif & _autre) const;
+        double somme() const;
+        double norme() const;
+
+        // Conversions
+        Vecteur versDense() const;
+        VecteurCreux versCreux() const;
+        void optimiser();
+
+        // Mthodes utilitaires
+        bool estCreux() const;
+        size_t getDimension() const;
+        size_t getNombreNonNuls() const;
+        static bool doitEtreCreux(const size_t _nombreNonNuls, const size_t _dimension);
+
+    private:
+        variant<Vecteur, VecteurCreux> representation;
+};
+
+#endif // VECTEURCREUX_H
@@ -0,0 +1,387 @@
+#ifndef VECTEUREXPRESSION_H
+#define VECTEUREXPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+
+#include "Noyaux.h"
+
+using namespace std;
+
+class Vecteur;
+
+/** \brief Classe de base de toutes les expressions vectorielles paresseuses (patron CRTP,  Curiously Recurring Template Pattern ).
+ * Une expression comme `a + b * 2.0 - c` ne calcule rien au moment o on l'crit: chaque oprateur retourne un petit objet qui se souvient de ses
+ * oprandes. Le calcul se fait seulement quand on assigne l'expression  un Vecteur, en une seule boucle et avec une seule allocation, au lieu d'un
+ * Vecteur temporaire (et d'un passage complet en mmoire) par oprateur.
+ * Chaque classe drive `E` doit fournir `size_t getDimension() const` et `double evaluer(const size_t _index) const`.
+ */
+template <typename E>
+class ExpressionVecteur
+{
+    public:
+        /** \brief Permet de retrouver le type rel de l'expression (la classe drive)  partir de la classe de base.
+         * \return Une rfrence constante vers l'expression drive.
+         */
+        const E & derivee() const {
+            return static_cast<const E &>(*this);
+        }
+
+        /** \brief Somme des lments de l'expression, calcule sans matrialiser de Vecteur intermdiaire.
+         * \return La somme des lments (double).
+         */
+        double somme() const {
+            const E & expression = derivee();
+            const size_t dimension = expression.getDimension();
+            double retour = 0;
+            for (size_t i = 0; i < dimension; i++){
+                retour += expression.evaluer(i);
+            }
+            return retour;
+        }
+
+        /** \brief Produit scalaire entre l'expression courante et une autre expression, sans Vecteur intermdiaire.
+         * Par exemple, `(a - b).dot(a - b)` ne fait aucune allocation.
+         * \param _autre: expression avec laquelle faire le produit scalaire. Doit tre de mme dimension.
+         * \return Le produit scalaire (double).
+         */
+        template <typename F>
+        double dot(const ExpressionVecteur<F> & _autre) const {
+            const E & expression = derivee();
+            const F & autre = _autre.derivee();
+            const size_t dimension = expression.getDimension();
+            if (dimension != autre.getDimension()){
+                throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+            }
+            double retour = 0;
+            for (size_t i = 0; i < dimension; i++){
+                retour += expression.evaluer(i) * autre.evaluer(i);
+            }
+            return retour;
+        }
+
+        /** \brief Norme euclidienne de l'expression, par exemple la distance `(a - b).norme()` sans allocation.
+         * \return La norme (double).
+         */
+        double norme() const {
+            const E & expression = derivee();
+            const size_t dimension = expression.getDimension();
+            double retour = 0;
+            for (size_t i = 0; i < dimension; i++){
+                const double valeur = expression.evaluer(i);
+                retour += valeur * valeur;
+            }
+            return sqrt(retour);
+        }
+
+        /** \brief Indique si, pour calculer un lment `i`, l'expression peut lire un lment de la destination `_donnees[j * _pas]`
+         * (`j < _dimension`) autre que `_donnees[i * _pas]`, celui qu'elle remplace. Dans ce cas, crire le rsultat directement dans la
+         * destination changerait des lments pas encore lus (par exemple `v.tranche(1, n) = v.tranche(0, n - 1)`).
+         * Par dfaut, une expression a sa propre mmoire: faux. Vecteur, VueVecteur et les noeuds d'expression redfinissent la mthode.
+         * La rponse est prudente: deux vues entrelaces (lments pairs et impairs) sont considres comme chevauchantes.
+         */
+        bool chevauche(const double *, const size_t, const size_t) const {
+            return false;
+        }
+
+    protected:
+        constexpr ExpressionVecteur() {}
+
+        /** \brief Chevauchement entre des lments lus `_lus[i * _pasLu]` et une destination `_ecrits[j * _pasEcrit]`, sauf si les deux
+         * ont exactement la mme disposition (l'lment `i` lu est alors celui qui est remplac).
+         */
+        static bool chevaucheMemoire(const double * _lus, const size_t _dimensionLue, const size_t _pasLu,
+                                     const double * _ecrits, const size_t _dimensionEcrite, const size_t _pasEcrit){
+            if (_dimensionLue == 0 || _dimensionEcrite == 0 || (_lus == _ecrits && _pasLu == _pasEcrit)){
+                return false;
+            }
+            // Comparaison des adresses en entiers: comparer des pointeurs vers des tableaux diffrents n'est pas dfini.
+            const uintptr_t debutLu = uintptr_t(_lus);
+            const uintptr_t finLu = debutLu + ((_dimensionLue - 1) * _pasLu + 1) * sizeof(double);
+            const uintptr_t debutEcrit = uintptr_t(_ecrits);
+            const uintptr_t finEcrit = debutEcrit + ((_dimensionEcrite - 1) * _pasEcrit + 1) * sizeof(double);
+            return debutLu < finEcrit && debutEcrit < finLu;
+        }
+};
+
+/** \brief Indique comment un noeud d'expression conserve ses oprandes.
+ * Par dfaut, les noeuds (petits objets) sont copis par valeur: ainsi une expression reste valide mme si les noeuds temporaires qui l'ont construite
+ * sont dtruits. Les Vecteurs, eux, sont conservs par rfrence pour ne jamais copier leurs donnes.
+ */
+template <typename E>
+struct StockageExpression
+{
+    typedef const E type;
+};
+
+template <>
+struct StockageExpression<Vecteur>
+{
+    typedef const Vecteur & type;
+};
+
+/** \brief Oprations lment par lment utilises par les noeuds d'expression.
+ * Chaque opration fournit `appliquer(...)` et le message d'erreur  lancer si les dimensions ne concordent pas.
+ */
+struct OperationAddition
+{
+    static constexpr double appliquer(const double _gauche, const double _droite) { return _gauche + _droite; }
+    static const char * messageDimension() { return "Les dimensions ne concordent pas pour l'addition vectorielle."; }
+};
+
+struct OperationSoustraction
+{
+    static constexpr double appliquer(const double _gauche, const double _droite) { return _gauche - _droite; }
+    static const char * messageDimension() { return "Les dimensions ne concordent pas pour l'addition vectorielle."; }
+};
+
+struct OperationMultiplication
+{
+    static constexpr double appliquer(const double _gauche, const double _droite) { return _gauche * _droite; }
+};
+
+struct OperationDivision
+{
+    static constexpr double appliquer(const double _gauche, const double _droite) { return _gauche / _droite; }
+};
+
+/** \brief Noeud d'expression entre deux expressions vectorielles (par exemple `a + b`).
+ * La vrification des dimensions se fait ds la construction du noeud, comme le faisaient les oprateurs non paresseux: l'erreur est donc lance
+ *  l'endroit mme o on crit l'opration.
+ */
+template <typename E1, typename E2, typename Op>
+class ExpressionBinaire : public ExpressionVecteur<ExpressionBinaire<E1, E2, Op> >
+{
+    public:
+        ExpressionBinaire(const E1 & _gauche, const E2 & _droite) : gauche(_gauche), droite(_droite) {
+            if (gauche.getDimension() != droite.getDimension()){
+                throw runtime_error(Op::messageDimension());
+            }
+        }
+
+        size_t getDimension() const {
+            return gauche.getDimension();
+        }
+
+        double evaluer(const size_t _index) const {
+            return Op::appliquer(gauche.evaluer(_index), droite.evaluer(_index));
+        }
+
+        bool chevauche(const double * _donnees, const size_t _dimension, const size_t _pas) const {
+            return gauche.chevauche(_donnees, _dimension, _pas) || droite.chevauche(_donnees, _dimension, _pas);
+        }
+
+    private:
+        typename StockageExpression<E1>::type gauche;
+        typename StockageExpression<E2>::type droite;
+};
+
+/** \brief Noeud d'expression entre une expression vectorielle et un scalaire (par exemple `b * 2.0`).
+ */
+template <typename E, typename Op>
+class ExpressionScalaire : public ExpressionVecteur<ExpressionScalaire<E, Op> >
+{
+    public:
+        ExpressionScalaire(const E & _expression, const double _scalaire) : expression(_expression), scalaire(_scalaire) {}
+
+        size_t getDimension() const {
+            return expression.getDimension();
+        }
+
+        double evaluer(const size_t _index) const {
+            return Op::appliquer(expression.evaluer(_index), scalaire);
+        }
+
+        bool chevauche(const double * _donnees, const size_t _dimension, const size_t _pas) const {
+            return expression.chevauche(_donnees, _dimension, _pas);
+        }
+
+    private:
+        typename StockageExpression<E>::type expression;
+        double scalaire;
+};
+
+/** \brief Intervalle paresseux: l'lment `i` vaut `debut + i * pas`, calcul  la demande. Aucune mmoire n'est alloue; `Vecteur v = intervalle;`
+ * le matrialise (voir aussi `Vecteur(debut, fin, pas)`), et il se mlange aux autres expressions (par exemple `(x - intervalle).norme()`).
+ * Le nombre d'lments est calcul une seule fois,  la construction. Chaque lment est calcul directement  partir de son index, et non en
+ * additionnant le pas  l'lment prcdent: l'erreur d'arrondi ne s'accumule pas, et le nombre d'lments ne dpend pas de cette erreur.
+ */
+class ExpressionIntervalle : public ExpressionVecteur<ExpressionIntervalle>
+{
+    public:
+        /** \brief Intervalle [_debut, _fin[ avec un pas donn (comme `range` ou `numpy.arange`): les lments `debut + i * pas` strictement
+         * avant `_fin`. Le pas peut tre ngatif (intervalle dcroissant). Si `_fin` est dj dpasse, l'intervalle est vide.
+         * \param _debut: premier lment.
+         * \param _fin: borne exclue.
+         * \param _pas: cart entre deux lments. Ne peut pas tre nul.
+         */
+        ExpressionIntervalle(const double _debut, const double _fin, const double _pas) : debut(_debut), pas(_pas), dimension(0) {
+            if (_pas == 0){
+                throw runtime_error("Le pas d'un intervalle ne peut pas tre nul.");
+            }
+            if (!isfinite(_debut) || !isfinite(_fin) || !isfinite(_pas)){
+                throw runtime_error("Les bornes et le pas d'un intervalle doivent tre finis.");
+            }
+            const double quotient = (_fin - _debut) / _pas;
+            if (quotient > 0){
+                if (quotient >= 9007199254740992.0){
+                    throw runtime_error("L'intervalle contient trop d'lments.");
+                }
+                // La division est arrondie: le plafond peut se tromper d'un lment. On corrige avec les lments rellement calculs.
+                dimension = size_t(ceil(quotient));
+                while (dimension > 0 && !estAvant(calculer(dimension - 1), _fin)){
+                    dimension--;
+                }
+                while (estAvant(calculer(dimension), _fin)){
+                    dimension++;
+                }
+            }
+            dernier = dimension > 0 ? calculer(dimension - 1) : _debut;
+        }
+
+        /** \brief `_nombre` lments galement espacs de `_debut`  `_fin` (comme `numpy.linspace`). Avec `_inclureFin`, le dernier lment
+         * vaut exactement `_fin`.
+         * \param _debut: premier lment.
+         * \param _fin: dernier lment (ou borne exclue, sans `_inclureFin`).
+         * \param _nombre: nombre d'lments.
+         * \param _inclureFin: si vrai (par dfaut), `_fin` fait partie de l'intervalle.
+         * \return L'intervalle (paresseux).
+         */
+        static ExpressionIntervalle espaceLineaire(const double _debut, const double _fin, const size_t _nombre, const bool _inclureFin = true){
+            if (!isfinite(_debut) || !isfinite(_fin)){
+                throw runtime_error("Les bornes et le pas d'un intervalle doivent tre finis.");
+            }
+            const size_t intervalles = _inclureFin ? _nombre - 1 : _nombre;
+            const double pas = _nombre > 0 && intervalles > 0 ? (_fin - _debut) / double(intervalles) : 0;
+            const double dernier = _inclureFin && _nombre > 1 ? _fin : _debut + double(_nombre > 0 ? _nombre - 1 : 0) * pas;
+            return ExpressionIntervalle(_debut, pas, _nombre, dernier);
+        }
+
+        size_t getDimension() const {
+            return dimension;
+        }
+
+        double evaluer(const size_t _index) const {
+            return _index + 1 == dimension ? dernier : calculer(_index);
+        }
+
+        /** \brief crit les lments [_debutIndex, _finIndex[ dans `_destination`. Aucun lment ne dpend du prcdent: le noyau SIMD en calcule
+         * plusieurs  la fois (voir Noyaux::remplirIntervalle), et chaque fil peut en crire un morceau.
+         * \param _destination: tableau o crire l'lment `_debutIndex` en position 0.
+         * \param _debutIndex: index du premier lment  crire.
+         * \param _finIndex: index suivant le dernier lment  crire.
+         */
+        void remplir(double * _destination, const size_t _debutIndex, const size_t _finIndex) const {
+            if (_finIndex > _debutIndex){
+                Noyaux::remplirIntervalle(_destination, debut, pas, _debutIndex, _finIndex - _debutIndex);
+            }
+            if (_finIndex == dimension && _finIndex > _debutIndex){
+                _destination[_finIndex - 1 - _debutIndex] = dernier;
+            }
+        }
+
+        double getDebut() const { return debut; }
+        double getPas() const { return pas; }
+
+    private:
+        ExpressionIntervalle(const double _debut, const double _pas, const size_t _dimension, const double _dernier)
+            : debut(_debut), pas(_pas), dimension(_dimension), dernier(_dernier) {}
+
+        double calculer(const size_t _index) const {
+            return debut + double(_index) * pas;
+        }
+
+        bool estAvant(const double _valeur, const double _fin) const {
+            return pas > 0 ? _valeur < _fin : _valeur > _fin;
+        }
+
+        double debut;
+        double pas;
+        size_t dimension;
+        double dernier;
+};
+
+/** \brief Itrateur (en lecture seule) sur les lments d'une expression. Il sert  construire le vector<double> interne d'un Vecteur directement
+ *  partir de l'expression: le vector<double> connat ainsi sa taille d'avance, alloue une seule fois et crit chaque lment une seule fois (pas de
+ * remplissage initial  zro suivi d'une rcriture).
+ * C'est un itrateur mandataire ( proxy iterator , comme celui de vector<bool>): l'lment est calcul  la demande et n'existe nulle part en
+ * mmoire, donc `*it` le retourne par valeur (`reference` est `double`) et il n'y a pas d'`operator->`. Au sens strict de la norme, ce n'est donc pas
+ * un itrateur  accs alatoire, qui exige une vraie rfrence. Il en porte quand mme la catgorie pour que `vector::assign` calcule la distance
+ * (sans parcourir l'expression) et alloue une seule fois; avec `input_iterator_tag`, le vector grandirait lment par lment. Il ne sert qu'
+ * remplir un vector<double> (Vecteur, VueVecteur); les algorithmes qui lisent `*it` par valeur (`distance`, `lower_bound`) fonctionnent aussi, mais
+ * rien ne doit prendre l'adresse de `*it` ni en garder une rfrence.
+ */
+template <typename E>
+class IterateurExpression
+{
+    public:
+        typedef random_access_iterator_tag iterator_category;
+        typedef double value_type;
+        typedef ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef double reference;
+
+        IterateurExpression(const E & _expression, const size_t _index) : expression(&_expression), index(_index) {}
+
+        double operator*() const { return expression->evaluer(index); }
+        IterateurExpression & operator++() { index++; return *this; }
+        IterateurExpression operator++(int) { IterateurExpression copie(*this); index++; return copie; }
+        IterateurExpression & operator--() { index--; return *this; }
+        IterateurExpression operator--(int) { IterateurExpression copie(*this); index--; return copie; }
+        IterateurExpression & operator+=(const difference_type _pas) { index += _pas; return *this; }
+        IterateurExpression & operator-=(const difference_type _pas) { index -= _pas; return *this; }
+        IterateurExpression operator+(const difference_type _pas) const { return IterateurExpression(*expression, index + _pas); }
+        IterateurExpression operator-(const difference_type _pas) const { return IterateurExpression(*expression, index - _pas); }
+        friend IterateurExpression operator+(const difference_type _pas, const IterateurExpression & _iterateur) { return _iterateur + _pas; }
+        difference_type operator-(const IterateurExpression & _autre) const { return difference_type(index) - difference_type(_autre.index); }
+        double operator[](const difference_type _pas) const { return expression->evaluer(index + _pas); }
+        bool operator==(const IterateurExpression & _autre) const { return index == _autre.index; }
+        bool operator!=(const IterateurExpression & _autre) const { return index != _autre.index; }
+        bool operator<(const IterateurExpression & _autre) const { return index < _autre.index; }
+        bool operator>(const IterateurExpression & _autre) const { return index > _autre.index; }
+        bool operator<=(const IterateurExpression & _autre) const { return index <= _autre.index; }
+        bool operator>=(const IterateurExpression & _autre) const { return index >= _autre.index; }
+
+    private:
+        const E * expression;
+        size_t index;
+};
+
+// Oprateurs vecteur avec vecteur (paresseux)
+
+template <typename E1, typename E2>
+ExpressionBinaire<E1, E2, OperationAddition> operator+(const ExpressionVecteur<E1> & _gauche, const ExpressionVecteur<E2> & _droite){
+    return ExpressionBinaire<E1, E2, OperationAddition>(_gauche.derivee(), _droite.derivee());
+}
+
+template <typename E1, typename E2>
+ExpressionBinaire<E1, E2, OperationSoustraction> operator-(const ExpressionVecteur<E1> & _gauche, const ExpressionVecteur<E2> & _droite){
+    return ExpressionBinaire<E1, E2, OperationSoustraction>(_gauche.derivee(), _droite.derivee());
+}
+
+// Oprateurs vecteur avec scalaire (paresseux)
+
+template <typename E>
+ExpressionScalaire<E, OperationAddition> operator+(const ExpressionVecteur<E> & _gauche, const double _droite){
+    return ExpressionScalaire<E, OperationAddition>(_gauche.derivee(), _droite);
+}
+
+template <typename E>
+ExpressionScalaire<E, OperationSoustraction> operator-(const ExpressionVecteur<E> & _gauche, const double _droite){
+    return ExpressionScalaire<E, OperationSoustraction>(_gauche.derivee(), _droite);
+}
+
+template <typename E>
+ExpressionScalaire<E, OperationMultiplication> operator*(const ExpressionVecteur<E> & _gauche, const double _droite){
+    return ExpressionScalaire<E, OperationMultiplication>(_gauche.derivee(), _droite);
+}
+
+template <typename E>
+ExpressionScalaire<E, OperationDivision> operator/(const ExpressionVecteur<E> & _gauche, const double _droite){
+    return ExpressionScalaire<E, OperationDivision>(_gauche.derivee(), _droite);
+}
+
+#endif // VECTEUREXPRESSION_H
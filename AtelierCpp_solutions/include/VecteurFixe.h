@@ -0,0 +1,206 @@
+#ifndef VECTEURFIXE_H
+#define VECTEURFIXE_H
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Vecteur.h"
+#include "VecteurExpression.h"
+
+using namespace std;
+
+/** \brief Vecteur de dimension fixe N, connue  la compilation (par exemple VecteurFixe<3> pour la gomtrie 3D).
+ * Contrairement  Vecteur, les lments sont stocks directement dans l'objet (sur la pile): aucune allocation, aucune vrification de dimension 
+ * l'excution (deux VecteurFixe de dimensions diffrentes ne peuvent tout simplement pas tre additionns: a ne compile pas). Toutes les oprations
+ * sont `constexpr` et droules  la compilation (avec `index_sequence`), donc le compilateur peut les calculer d'avance ou les intgrer
+ * compltement dans le code appelant. `cross(...)` n'existe que pour N == 3.
+ *
+ * Interoprabilit avec Vecteur: VecteurFixe est aussi une expression vectorielle (voir VecteurExpression.h). On peut donc crire
+ * `Vecteur v = fixe;` ou `Vecteur w = fixe + dynamique;`. Dans l'autre sens, le constructeur `VecteurFixe(const Vecteur &)` vrifie la dimension.
+ */
+template <size_t N>
+class VecteurFixe : public ExpressionVecteur<VecteurFixe<N> >
+{
+    public:
+        // Constructeurs
+        constexpr VecteurFixe() : valeurs() {}
+
+        constexpr explicit VecteurFixe(const array<double, N> & _valeurs) : valeurs(_valeurs) {}
+
+        /** \brief Constructeur  partir des N composantes, par exemple `VecteurFixe<3> v(1.0, 2.0, 3.0);`.
+         */
+        template <typename... Composantes, typename = typename enable_if<sizeof...(Composantes) == N && (N > 1)>::type>
+        constexpr VecteurFixe(const Composantes... _composantes) : valeurs{{double(_composantes)...}} {}
+
+        /** \brief Cre un VecteurFixe dont toutes les composantes valent `_valeur`.
+         */
+        static constexpr VecteurFixe remplir(const double _valeur){
+            return remplir(_valeur, make_index_sequence<N>());
+        }
+
+        /** \brief Copie un Vecteur (dynamique) dans un VecteurFixe. La dimension du Vecteur doit tre N.
+         * \param _autre: Vecteur  copier.
+         */
+        explicit VecteurFixe(const Vecteur & _autre) : valeurs() {
+            if (_autre.getDimension() != N){
+                throw runtime_error("Les dimensions ne concordent pas pour la conversion en vecteur de taille fixe.");
+            }
+            for (size_t i = 0; i < N; i++){
+                valeurs[i] = _autre.evaluer(i);
+            }
+        }
+
+        /** \brief Copie le VecteurFixe dans un nouveau Vecteur (dynamique).
+         */
+        Vecteur versVecteur() const {
+            return Vecteur(*this);
+        }
+
+        // Accs
+        constexpr double & operator[](const size_t _index){
+            if (_index >= N){
+                throw runtime_error("L'index est en-dehors du vecteur.");
+            }
+            return valeurs[_index];
+        }
+
+        constexpr double operator[](const size_t _index) const {
+            if (_index >= N){
+                throw runtime_error("L'index est en-dehors du vecteur.");
+            }
+            return valeurs[_index];
+        }
+
+        constexpr double evaluer(const size_t _index) const {
+            return valeurs[_index];
+        }
+
+        constexpr size_t getDimension() const {
+            return N;
+        }
+
+        // Mathmatiques vecteur avec vecteur
+        constexpr VecteurFixe operator+(const VecteurFixe & _autre) const {
+            return combiner(_autre, OperationAddition(), make_index_sequence<N>());
+        }
+
+        constexpr VecteurFixe operator-(const VecteurFixe & _autre) const {
+            return combiner(_autre, OperationSoustraction(), make_index_sequence<N>());
+        }
+
+        constexpr VecteurFixe operator-() const {
+            return (*this) * -1.0;
+        }
+
+        constexpr double operator*(const VecteurFixe & _autre) const {
+            return dot(_autre);
+        }
+
+        constexpr VecteurFixe & operator+=(const VecteurFixe & _autre){
+            return (*this) = (*this) + _autre;
+        }
+
+        constexpr VecteurFixe & operator-=(const VecteurFixe & _autre){
+            return (*this) = (*this) - _autre;
+        }
+
+        // Mathmatiques vecteur avec scalaire
+        constexpr VecteurFixe operator+(const double _autre) const {
+            return combinerScalaire(_autre, OperationAddition(), make_index_sequence<N>());
+        }
+
+        constexpr VecteurFixe operator-(const double _autre) const {
+            return combinerScalaire(_autre, OperationSoustraction(), make_index_sequence<N>());
+        }
+
+        constexpr VecteurFixe operator*(const double _autre) const {
+            return combinerScalaire(_autre, OperationMultiplication(), make_index_sequence<N>());
+        }
+
+        constexpr VecteurFixe operator/(const double _autre) const {
+            return combinerScalaire(_autre, OperationDivision(), make_index_sequence<N>());
+        }
+
+        constexpr VecteurFixe & operator*=(const double _autre){
+            return (*this) = (*this) * _autre;
+        }
+
+        constexpr VecteurFixe & operator/=(const double _autre){
+            return (*this) = (*this) / _autre;
+        }
+
+        // Mathmatiques autres
+        using ExpressionVecteur<VecteurFixe<N> >::dot;
+
+        /** \brief Produit scalaire, additionn de gauche  droite dans une seule somme (calculable  la compilation). Vecteur::dot passe plutt
+         * par les noyaux SIMD, qui additionnent avec plusieurs accumulateurs (voir Noyaux.h): les deux rsultats peuvent diffrer  l'arrondi prs.
+         */
+        constexpr double dot(const VecteurFixe & _autre) const {
+            return produitScalaire(_autre, make_index_sequence<N>());
+        }
+
+        /** \brief Produit vectoriel, dfini seulement pour N == 3 (pour les autres dimensions, l'appel ne compile pas).
+         */
+        template <size_t M = N, typename = typename enable_if<M == 3>::type>
+        constexpr VecteurFixe cross(const VecteurFixe & _autre) const {
+            return VecteurFixe((valeurs[1] * _autre.valeurs[2]) - (valeurs[2] * _autre.valeurs[1]),
+                               (valeurs[2] * _autre.valeurs[0]) - (valeurs[0] * _autre.valeurs[2]),
+                               (valeurs[0] * _autre.valeurs[1]) - (valeurs[1] * _autre.valeurs[0]));
+        }
+
+        constexpr double somme() const {
+            return somme(make_index_sequence<N>());
+        }
+
+        constexpr double normeCarree() const {
+            return dot(*this);
+        }
+
+        double norme() const {
+            return sqrt(normeCarree());
+        }
+
+    private:
+        template <typename Op, size_t... I>
+        constexpr VecteurFixe combiner(const VecteurFixe & _autre, Op, index_sequence<I...>) const {
+            return VecteurFixe(array<double, N>{{Op::appliquer(valeurs[I], _autre.valeurs[I])...}});
+        }
+
+        template <typename Op, size_t... I>
+        constexpr VecteurFixe combinerScalaire(const double _scalaire, Op, index_sequence<I...>) const {
+            return VecteurFixe(array<double, N>{{Op::appliquer(valeurs[I], _scalaire)...}});
+        }
+
+        template <size_t... I>
+        static constexpr VecteurFixe remplir(const double _valeur, index_sequence<I...>){
+            return VecteurFixe(array<double, N>{{((void)I, _valeur)...}});
+        }
+
+        template <size_t... I>
+        constexpr double produitScalaire(const VecteurFixe & _autre, index_sequence<I...>) const {
+            return (0.0 + ... + (valeurs[I] * _autre.valeurs[I]));
+        }
+
+        template <size_t... I>
+        constexpr double somme(index_sequence<I...>) const {
+            return (0.0 + ... + valeurs[I]);
+        }
+
+        array<double, N> valeurs;
+};
+
+/** \brief Multiplication scalaire  gauche (`2.0 * v`).
+ */
+template <size_t N>
+constexpr VecteurFixe<N> operator*(const double _scalaire, const VecteurFixe<N> & _vecteur){
+    return _vecteur * _scalaire;
+}
+
+typedef VecteurFixe<2> Vecteur2D;
+typedef VecteurFixe<3> Vecteur3D;
+typedef VecteurFixe<4> Vecteur4D;
+
+#endif // VECTEURFIXE_H
@@ -0,0 +1,257 @@
+#ifndef VUEVECTEUR_H
+#define VUEVECTEUR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Noyaux.h"
+#include "VecteurExpression.h"
+
+using namespace std;
+
+/** \brief Vue (sans proprit) sur des doubles qui existent dj ailleurs: un Vecteur, une partie d'un Vecteur, un vector<double>, une ligne ou
+ * une colonne de VecteurBatch, un fichier projet (VecteurMappe) ou la mmoire d'une autre bibliothque. Crer une vue ne copie rien et n'alloue
+ * rien: elle retient seulement un pointeur, une dimension et un pas (l'cart, en lments, entre deux lments conscutifs de la vue). Ainsi,
+ * `v.tranche(0, n, 2)` voit les lments pairs de `v` et la colonne `j` d'un VecteurBatch est une vue de pas `getPas()`.
+ *
+ * Deux variantes: VecteurVue (`VueVecteur<double>`) peut modifier les lments vus; VecteurVueConst (`VueVecteur<const double>`) est en lecture seule.
+ * Une vue est une expression vectorielle (voir VecteurExpression.h): elle s'utilise partout o un Vecteur est lu (`a + vue`, `a.dot(vue)`,
+ * `Vecteur copie = vue;`). Quand le pas vaut 1, `dot`, `somme` et `norme` utilisent les noyaux SIMD (voir Noyaux.h).
+ *
+ * Attention:
+ * - La vue ne garde pas la mmoire en vie: elle devient invalide si le propritaire est dtruit ou redimensionn.
+ * - Copier une vue copie la vue (le pointeur), pas les lments. Par contre, assigner  une vue modifiable (`vue = a + b;`, `vue = autreVue;`)
+ *   crit dans les lments vus, comme pour un Vecteur; la dimension doit concorder (une vue ne peut pas changer de taille).
+ * - `vue = expression`, `vue += expression` et `vue -= expression` donnent le mme rsultat si l'expression lit d'autres lments de la mme
+ *   mmoire (par exemple une tranche dcale qui chevauche la vue): l'expression est alors d'abord copie dans un vector<double> temporaire.
+ */
+template <typename T>
+class VueVecteur : public ExpressionVecteur<VueVecteur<T> >
+{
+    public:
+        typedef typename conditional<is_const<T>::value, const vector<double>, vector<double> >::type Conteneur;
+
+        // Constructeurs + assignation
+        VueVecteur(T * _donnees, const size_t _dimension, const size_t _pas = 1) : donnees(_donnees), dimension(_dimension), pas(_pas) {}
+
+        VueVecteur(Conteneur & _valeurs) : donnees(_valeurs.data()), dimension(_valeurs.size()), pas(1) {}
+
+        /** \brief Conversion d'une vue modifiable en vue en lecture seule.
+         */
+        template <typename U, typename = typename enable_if<is_same<const U, T>::value && !is_same<U, T>::value>::type>
+        VueVecteur(const VueVecteur<U> & _autre) : donnees(_autre.getDonnees()), dimension(_autre.getDimension()), pas(_autre.getPas()) {}
+
+        VueVecteur(const VueVecteur & _autre) = default;
+
+        VueVecteur & operator=(const VueVecteur & _autre){
+            return (*this) = static_cast<const ExpressionVecteur<VueVecteur> &>(_autre);
+        }
+
+        template <typename E>
+        VueVecteur & operator=(const ExpressionVecteur<E> & _expression);
+
+        // Accs (comme pour Vecteur, `operator[]` vrifie l'index seulement sans NDEBUG, `at` le vrifie toujours)
+        T & operator[](const size_t _index) const {
+#ifndef NDEBUG
+            return at(_index);
+#else
+            return donnees[_index * pas];
+#endif
+        }
+
+        T & at(const size_t _index) const {
+            if (_index >= dimension){
+                throw runtime_error("L'index est en-dehors du vecteur.");
+            }
+            return donnees[_index * pas];
+        }
+
+        double evaluer(const size_t _index) const {
+            return donnees[_index * pas];
+        }
+
+        bool chevauche(const double * _donnees, const size_t _dimension, const size_t _pas) const {
+            return ExpressionVecteur<VueVecteur<T> >::chevaucheMemoire(donnees, dimension, pas, _donnees, _dimension, _pas);
+        }
+
+        /** \brief Sous-vue des lments d'index `_debut`, `_debut + _pas`, ... strictement plus petits que `_fin` (comme `v[debut:fin:pas]` en Python).
+         * \param _debut: index du premier lment.
+         * \param _fin: index de fin (exclu). Doit tre au plus la dimension de la vue.
+         * \param _pas: pas entre deux lments de la sous-vue (au moins 1). Il peut dpasser la dimension: la sous-vue a alors au plus un lment.
+         * \return La sous-vue (aucune copie).
+         */
+        VueVecteur tranche(const size_t _debut, const size_t _fin, const size_t _pas = 1) const {
+            if (_pas == 0 || _debut > _fin || _fin > dimension){
+                throw runtime_error("La tranche est en-dehors du vecteur.");
+            }
+            // Calculs sans dpassement: `_fin - _debut + _pas - 1` et `pas * _pas` dpasseraient size_t pour un trs grand `_pas`.
+            const size_t nombre = _fin == _debut ? 0 : (_fin - _debut - 1) / _pas + 1;
+            if (nombre <= 1){
+                return VueVecteur(donnees + _debut * pas, nombre, pas);
+            }
+            if (_pas > SIZE_MAX / pas){
+                throw runtime_error("Le pas de la tranche est trop grand.");
+            }
+            return VueVecteur(donnees + _debut * pas, nombre, pas * _pas);
+        }
+
+        // Mathmatiques en place (vues modifiables seulement)
+        template <typename E>
+        VueVecteur & operator+=(const ExpressionVecteur<E> & _expression);
+        template <typename E>
+        VueVecteur & operator-=(const ExpressionVecteur<E> & _expression);
+        VueVecteur & operator+=(const double _autre);
+        VueVecteur & operator-=(const double _autre);
+        VueVecteur & operator*=(const double _autre);
+        VueVecteur & operator/=(const double _autre);
+
+        // Mathmatiques autres
+        using ExpressionVecteur<VueVecteur<T> >::dot;
+
+        template <typename U>
+        double dot(const VueVecteur<U> & _autre) const {
+            if (dimension != _autre.getDimension()){
+                throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+            }
+            if (pas == 1 && _autre.getPas() == 1){
+                return Noyaux::produitScalaire(donnees, _autre.getDonnees(), dimension);
+            }
+            return ExpressionVecteur<VueVecteur<T> >::dot(_autre);
+        }
+
+        double somme() const {
+            return pas == 1 ? Noyaux::somme(donnees, dimension) : ExpressionVecteur<VueVecteur<T> >::somme();
+        }
+
+        double norme() const {
+            return pas == 1 ? sqrt(Noyaux::sommeCarres(donnees, dimension)) : ExpressionVecteur<VueVecteur<T> >::norme();
+        }
+
+        // Mthodes utilitaires
+        T * getDonnees() const { return donnees; }
+        size_t getDimension() const { return dimension; }
+        size_t getPas() const { return pas; }
+        bool estContigue() const { return pas == 1; }
+
+    private:
+        void verifierModifiable() const {
+            static_assert(!is_const<T>::value, "Une vue en lecture seule (VecteurVueConst) ne peut pas tre modifie.");
+        }
+
+        T * donnees;
+        size_t dimension;
+        size_t pas;
+};
+
+typedef VueVecteur<double> VecteurVue;
+typedef VueVecteur<const double> VecteurVueConst;
+
+/** \brief crit une expression dans les lments vus. La dimension de l'expression doit tre celle de la vue.
+ * \param _expression: expression vectorielle  valuer.
+ * \return *this.
+ */
+template <typename T>
+template <typename E>
+VueVecteur<T> & VueVecteur<T>::operator=(const ExpressionVecteur<E> & _expression){
+    verifierModifiable();
+    const E & expression = _expression.derivee();
+    if (dimension != expression.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour l'assignation  une vue.");
+    }
+    if (expression.chevauche(donnees, dimension, pas)){
+        const vector<double> copie(IterateurExpression<E>(expression, 0), IterateurExpression<E>(expression, dimension));
+        return (*this) = VueVecteur<const double>(copie);
+    }
+    for (size_t i = 0; i < dimension; i++){
+        donnees[i * pas] = expression.evaluer(i);
+    }
+    return *this;
+}
+
+template <typename T>
+template <typename E>
+VueVecteur<T> & VueVecteur<T>::operator+=(const ExpressionVecteur<E> & _expression){
+    verifierModifiable();
+    const E & expression = _expression.derivee();
+    if (dimension != expression.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    if (expression.chevauche(donnees, dimension, pas)){
+        const vector<double> copie(IterateurExpression<E>(expression, 0), IterateurExpression<E>(expression, dimension));
+        return (*this) += VueVecteur<const double>(copie);
+    }
+    for (size_t i = 0; i < dimension; i++){
+        donnees[i * pas] += expression.evaluer(i);
+    }
+    return *this;
+}
+
+template <typename T>
+template <typename E>
+VueVecteur<T> & VueVecteur<T>::operator-=(const ExpressionVecteur<E> & _expression){
+    verifierModifiable();
+    const E & expression = _expression.derivee();
+    if (dimension != expression.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    if (expression.chevauche(donnees, dimension, pas)){
+        const vector<double> copie(IterateurExpression<E>(expression, 0), IterateurExpression<E>(expression, dimension));
+        return (*this) -= VueVecteur<const double>(copie);
+    }
+    for (size_t i = 0; i < dimension; i++){
+        donnees[i * pas] -= expression.evaluer(i);
+    }
+    return *this;
+}
+
+/** \brief Oprations scalaires en place. Sur une vue contigu, elles passent par les mmes noyaux SIMD que Vecteur.
+ */
+template <typename T>
+VueVecteur<T> & VueVecteur<T>::operator+=(const double _autre){
+    verifierModifiable();
+    if (pas == 1){
+        Noyaux::ajouterScalaire(donnees, _autre, dimension);
+        return *this;
+    }
+    for (size_t i = 0; i < dimension; i++){
+        donnees[i * pas] += _autre;
+    }
+    return *this;
+}
+
+template <typename T>
+VueVecteur<T> & VueVecteur<T>::operator-=(const double _autre){
+    return (*this) += -_autre;
+}
+
+template <typename T>
+VueVecteur<T> & VueVecteur<T>::operator*=(const double _autre){
+    verifierModifiable();
+    if (pas == 1){
+        Noyaux::multiplierScalaire(donnees, _autre, dimension);
+        return *this;
+    }
+    for (size_t i = 0; i < dimension; i++){
+        donnees[i * pas] *= _autre;
+    }
+    return *this;
+}
+
+template <typename T>
+VueVecteur<T> & VueVecteur<T>::operator/=(const double _autre){
+    verifierModifiable();
+    if (pas == 1){
+        Noyaux::diviserScalaire(donnees, _autre, dimension);
+        return *this;
+    }
+    for (size_t i = 0; i < dimension; i++){
+        donnees[i * pas] /= _autre;
+    }
+    return *this;
+}
+
+#endif // VUEVECTEUR_H
@@ -0,0 +1,65 @@
+#include "ExecutionAsynchrone.h"
+
+/** \brief Constructeur de la classe ExecuteurBorne.
+ * \param _capacite: nombre maximal de tches en cours; 0 pour deux par fil du rservoir (fil appelant compris).
+ * \param _reservoir: rservoir qui excute les tches.
+ */
+ExecuteurBorne::ExecuteurBorne(const size_t _capacite, ReservoirTaches & _reservoir)
+    : reservoir(_reservoir), capacite(_capacite == 0 ? 2 * (_reservoir.getNombreTravailleurs() + 1) : _capacite), enCours(0)
+{
+}
+
+/** \brief Destructeur: attend la fin des tches soumises (leurs `future` restent valides).
+ */
+ExecuteurBorne::~ExecuteurBorne()
+{
+    attendre();
+}
+
+/** \brief Attend que toutes les tches soumises soient termines. En attendant, le fil excute lui-mme des tches du rservoir.
+ */
+void ExecuteurBorne::attendre(){
+    unique_lock<mutex> garde(verrou);
+    while (enCours > 0){
+        garde.unlock();
+        const bool aide = reservoir.aider();
+        garde.lock();
+        if (!aide && enCours > 0){
+            place.wait_for(garde, chrono::milliseconds(1));
+        }
+    }
+}
+
+size_t ExecuteurBorne::getCapacite() const {
+    return capacite;
+}
+
+/** \brief Nombre de tches soumises qui ne sont pas encore termines.
+ */
+size_t ExecuteurBorne::getEnCours() const {
+    lock_guard<mutex> garde(verrou);
+    return enCours;
+}
+
+/** \brief Rserve une place pour une nouvelle tche, en attendant (et en aidant le rservoir) si la capacit est atteinte.
+ */
+void ExecuteurBorne::reserver(){
+    unique_lock<mutex> garde(verrou);
+    while (enCours >= capacite){
+        garde.unlock();
+        const bool aide = reservoir.aider();
+        garde.lock();
+        if (!aide && enCours >= capacite){
+            place.wait_for(garde, chrono::milliseconds(1));
+        }
+    }
+    enCours++;
+}
+
+/** \brief Libre la place d'une tche termine. On avertit en gardant le verrou: ds qu'il est relch, l'excuteur peut tre dtruit.
+ */
+void ExecuteurBorne::liberer(){
+    lock_guard<mutex> garde(verrou);
+    enCours--;
+    place.notify_all();
+}
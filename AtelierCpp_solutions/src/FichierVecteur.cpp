@@ -0,0 +1,340 @@
+#include "FichierVecteur.h"
+#include "Noyaux.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(EnteteFichierVecteur) == 64, "L'en-tte d'un fichier de Vecteur doit faire exactement 64 octets.");
+
+namespace
+{
+    const char SIGNATURE[8] = {'V', 'E', 'C', 'T', 'E', 'U', 'R', '\0'};
+
+    EnteteFichierVecteur creerEntete(const size_t _dimension){
+        EnteteFichierVecteur entete;
+        memset(&entete, 0, sizeof(entete));
+        memcpy(entete.signature, SIGNATURE, sizeof(SIGNATURE));
+        entete.version = EnteteFichierVecteur::VERSION;
+        entete.marqueurBoutisme = EnteteFichierVecteur::MARQUEUR_BOUTISME;
+        entete.typeDonnees = EnteteFichierVecteur::FLOAT64;
+        entete.tailleElement = sizeof(double);
+        entete.dimension = _dimension;
+        entete.alignement = EnteteFichierVecteur::ALIGNEMENT;
+        entete.decalageDonnees = EnteteFichierVecteur::ALIGNEMENT; // L'en-tte occupe exactement le premier bloc align.
+        return entete;
+    }
+
+    /** \brief Vrifie qu'un en-tte dcrit bien un fichier lisible par cette version, dont la taille est `_tailleFichier` octets.
+     */
+    void validerEntete(const EnteteFichierVecteur & _entete, const uint64_t _tailleFichier, const string & _chemin){
+        if (memcmp(_entete.signature, SIGNATURE, sizeof(SIGNATURE)) != 0){
+            throw runtime_error("Le fichier " + _chemin + " n'est pas un fichier de Vecteur.");
+        }
+        if (_entete.marqueurBoutisme != EnteteFichierVecteur::MARQUEUR_BOUTISME){
+            throw runtime_error("Le fichier " + _chemin + " a t crit sur une machine de boutisme (endianness) diffrent.");
+        }
+        if (_entete.version != EnteteFichierVecteur::VERSION){
+            throw runtime_error("La version du fichier " + _chemin + " n'est pas supporte.");
+        }
+        if (_entete.typeDonnees != EnteteFichierVecteur::FLOAT64 || _entete.tailleElement != sizeof(double)){
+            throw runtime_error("Le type des lments du fichier " + _chemin + " n'est pas support.");
+        }
+        // Les lments sont lus en place (VecteurMappe): ils doivent commencer sur une frontire de 64 octets, comme promis par getDonnees().
+        if (_entete.alignement == 0 || _entete.alignement % EnteteFichierVecteur::ALIGNEMENT != 0 || _entete.decalageDonnees % _entete.alignement != 0
+            || _entete.decalageDonnees < sizeof(EnteteFichierVecteur)){
+            throw runtime_error("L'en-tte du fichier " + _chemin + " est invalide.");
+        }
+        if (_entete.dimension > (_tailleFichier - min<uint64_t>(_tailleFichier, _entete.decalageDonnees)) / sizeof(double)){
+            throw runtime_error("Le fichier " + _chemin + " est tronqu.");
+        }
+    }
+}
+
+/** \brief crit des lments bruts dans un fichier: l'en-tte, puis les lments d'un seul bloc.
+ * \param _chemin: chemin du fichier (remplac s'il existe dj).
+ * \param _elements: pointeur vers le premier lment.
+ * \param _dimension: nombre d'lments.
+ */
+void FichierVecteur::ecrire(const string & _chemin, const double * _elements, const size_t _dimension){
+    ofstream fichier(_chemin.c_str(), ios::binary | ios::trunc);
+    if (!fichier){
+        throw runtime_error("Impossible d'ouvrir le fichier " + _chemin + " en criture.");
+    }
+    const EnteteFichierVecteur entete = creerEntete(_dimension);
+    fichier.write(reinterpret_cast<const char *>(&entete), sizeof(entete));
+    fichier.write(reinterpret_cast<const char *>(_elements), streamsize(_dimension * sizeof(double)));
+    if (!fichier){
+        throw runtime_error("Erreur d'criture dans le fichier " + _chemin + ".");
+    }
+}
+
+/** \brief crit un Vecteur dans un fichier. Les lments sont copis par blocs dans un petit tampon avant l'criture, ce qui garde la mmoire
+ * utilise constante, peu importe la dimension.
+ * \param _chemin: chemin du fichier (remplac s'il existe dj).
+ * \param _vecteur: Vecteur  crire.
+ */
+void FichierVecteur::ecrire(const string & _chemin, const Vecteur & _vecteur){
+    ofstream fichier(_chemin.c_str(), ios::binary | ios::trunc);
+    if (!fichier){
+        throw runtime_error("Impossible d'ouvrir le fichier " + _chemin + " en criture.");
+    }
+    const size_t dimension = _vecteur.getDimension();
+    const EnteteFichierVecteur entete = creerEntete(dimension);
+    fichier.write(reinterpret_cast<const char *>(&entete), sizeof(entete));
+
+    const size_t TAILLE_TAMPON = 8192;
+    double tampon[TAILLE_TAMPON];
+    for (size_t debut = 0; debut < dimension; debut += TAILLE_TAMPON){
+        const size_t fin = min(dimension, debut + TAILLE_TAMPON);
+        for (size_t i = debut; i < fin; i++){
+            tampon[i - debut] = _vecteur.evaluer(i);
+        }
+        fichier.write(reinterpret_cast<const char *>(tampon), streamsize((fin - debut) * sizeof(double)));
+    }
+    if (!fichier){
+        throw runtime_error("Erreur d'criture dans le fichier " + _chemin + ".");
+    }
+}
+
+/** \brief Lit et valide l'en-tte d'un fichier de Vecteur.
+ * \param _chemin: chemin du fichier.
+ * \return L'en-tte.
+ */
+EnteteFichierVecteur FichierVecteur::lireEntete(const string & _chemin){
+    ifstream fichier(_chemin.c_str(), ios::binary | ios::ate);
+    if (!fichier){
+        throw runtime_error("Impossible d'ouvrir le fichier " + _chemin + " en lecture.");
+    }
+    const uint64_t tailleFichier = uint64_t(fichier.tellg());
+    EnteteFichierVecteur entete;
+    fichier.seekg(0);
+    if (tailleFichier < sizeof(entete) || !fichier.read(reinterpret_cast<char *>(&entete), sizeof(entete))){
+        throw runtime_error("Le fichier " + _chemin + " n'est pas un fichier de Vecteur.");
+    }
+    validerEntete(entete, tailleFichier, _chemin);
+    return entete;
+}
+
+/** \brief Lit un fichier complet dans un nouveau Vecteur. Les lments sont lus directement dans la mmoire du Vecteur (aucune conversion).
+ * \param _chemin: chemin du fichier.
+ * \return Le Vecteur lu.
+ */
+Vecteur FichierVecteur::lire(const string & _chemin){
+    const EnteteFichierVecteur entete = lireEntete(_chemin);
+    ifstream fichier(_chemin.c_str(), ios::binary);
+    if (!fichier){
+        throw runtime_error("Impossible d'ouvrir le fichier " + _chemin + " en lecture.");
+    }
+    Vecteur retour(size_t(entete.dimension), 0);
+    if (entete.dimension > 0){
+        fichier.seekg(streamoff(entete.decalageDonnees));
+        if (!fichier.read(reinterpret_cast<char *>(&retour[0]), streamsize(entete.dimension * sizeof(double)))){
+            throw runtime_error("Erreur de lecture dans le fichier " + _chemin + ".");
+        }
+    }
+    return retour;
+}
+
+/** \brief Constructeur: ouvre le fichier et le projette en mmoire, en lecture seule. Seul l'en-tte est lu immdiatement.
+ * \param _chemin: chemin d'un fichier crit par `FichierVecteur::ecrire(...)`.
+ */
+VecteurMappe::VecteurMappe(const string & _chemin)
+    : donnees(nullptr), dimension(0), projection(nullptr), tailleProjection(0)
+{
+#ifdef _WIN32
+    objetProjection = nullptr;
+    fichier = CreateFileA(_chemin.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fichier == INVALID_HANDLE_VALUE){
+        fichier = nullptr;
+        throw runtime_error("Impossible d'ouvrir le fichier " + _chemin + " en lecture.");
+    }
+    LARGE_INTEGER taille;
+    if (!GetFileSizeEx(fichier, &taille) || uint64_t(taille.QuadPart) < sizeof(EnteteFichierVecteur)){
+        fermer();
+        throw runtime_error("Le fichier " + _chemin + " n'est pas un fichier de Vecteur.");
+    }
+    tailleProjection = size_t(taille.QuadPart);
+    objetProjection = CreateFileMappingA(fichier, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (objetProjection != nullptr){
+        projection = MapViewOfFile(objetProjection, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (projection == nullptr){
+        fermer();
+        throw runtime_error("Impossible de projeter le fichier " + _chemin + " en mmoire.");
+    }
+#else
+    const int descripteur = open(_chemin.c_str(), O_RDONLY);
+    if (descripteur < 0){
+        throw runtime_error("Impossible d'ouvrir le fichier " + _chemin + " en lecture.");
+    }
+    struct stat informations;
+    if (fstat(descripteur, &informations) != 0 || uint64_t(informations.st_size) < sizeof(EnteteFichierVecteur)){
+        close(descripteur);
+        throw runtime_error("Le fichier " + _chemin + " n'est pas un fichier de Vecteur.");
+    }
+    tailleProjection = size_t(informations.st_size);
+    void * adresse = mmap(nullptr, tailleProjection, PROT_READ, MAP_SHARED, descripteur, 0);
+    close(descripteur); // La projection garde sa propre rfrence vers le fichier.
+    if (adresse == MAP_FAILED){
+        throw runtime_error("Impossible de projeter le fichier " + _chemin + " en mmoire.");
+    }
+    projection = adresse;
+#endif
+    const EnteteFichierVecteur * entete = static_cast<const EnteteFichierVecteur *>(projection);
+    try {
+        validerEntete(*entete, tailleProjection, _chemin);
+    }
+    catch (...){
+        fermer();
+        throw;
+    }
+    dimension = size_t(entete->dimension);
+    donnees = reinterpret_cast<const double *>(static_cast<const char *>(projection) + entete->decalageDonnees);
+}
+
+/** \brief Constructeur par dplacement: la projection passe  la nouvelle vue, l'autre devient vide (dimension 0).
+ */
+VecteurMappe::VecteurMappe(VecteurMappe && _autre) noexcept
+    : donnees(_autre.donnees), dimension(_autre.dimension), projection(_autre.projection), tailleProjection(_autre.tailleProjection)
+{
+#ifdef _WIN32
+    fichier = _autre.fichier;
+    objetProjection = _autre.objetProjection;
+    _autre.fichier = nullptr;
+    _autre.objetProjection = nullptr;
+#endif
+    _autre.donnees = nullptr;
+    _autre.dimension = 0;
+    _autre.projection = nullptr;
+    _autre.tailleProjection = 0;
+}
+
+/** \brief Assignation par dplacement: libre la projection courante, puis prend celle de l'autre vue.
+ */
+VecteurMappe & VecteurMappe::operator=(VecteurMappe && _autre) noexcept
+{
+    if (this == & _autre){
+        return *this;
+    }
+    fermer();
+    donnees = _autre.donnees;
+    dimension = _autre.dimension;
+    projection = _autre.projection;
+    tailleProjection = _autre.tailleProjection;
+#ifdef _WIN32
+    fichier = _autre.fichier;
+    objetProjection = _autre.objetProjection;
+    _autre.fichier = nullptr;
+    _autre.objetProjection = nullptr;
+#endif
+    _autre.donnees = nullptr;
+    _autre.dimension = 0;
+    _autre.projection = nullptr;
+    _autre.tailleProjection = 0;
+    return *this;
+}
+
+/** \brief Destructeur: retire la projection (les pages ne sont plus accessibles).
+ */
+VecteurMappe::~VecteurMappe()
+{
+    fermer();
+}
+
+void VecteurMappe::fermer(){
+#ifdef _WIN32
+    if (projection != nullptr){
+        UnmapViewOfFile(projection);
+    }
+    if (objetProjection != nullptr){
+        CloseHandle(objetProjection);
+    }
+    if (fichier != nullptr){
+        CloseHandle(fichier);
+    }
+    fichier = nullptr;
+    objetProjection = nullptr;
+#else
+    if (projection != nullptr){
+        munmap(projection, tailleProjection);
+    }
+#endif
+    projection = nullptr;
+    tailleProjection = 0;
+    donnees = nullptr;
+    dimension = 0;
+}
+
+/** \brief Accs en lecture  un lment, avec vrification de l'index.
+ * \param _index: index de l'lment. Doit tre strictement plus petit que la dimension, sinon une erreur est lance.
+ * \return La valeur de l'lment.
+ */
+double VecteurMappe::operator[](const size_t _index) const {
+    if (_index >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return donnees[_index];
+}
+
+/** \brief Pointeur vers les lments projets (aligns sur 64 octets), par exemple pour les passer  Noyaux.
+ */
+const double * VecteurMappe::getDonnees() const {
+    return donnees;
+}
+
+/** \brief Vue sur les lments projets (voir VueVecteur.h), par exemple pour n'utiliser qu'une tranche du fichier: `mappe.vue().tranche(a, b)`.
+ */
+VecteurVueConst VecteurMappe::vue() const {
+    return VecteurVueConst(donnees, dimension);
+}
+
+/** \brief Produit scalaire entre deux vues projetes (noyau SIMD `Noyaux::produitScalaire`).
+ * \param _autre: vue avec laquelle faire le produit scalaire. Doit tre de mme dimension.
+ * \return Le produit scalaire (double).
+ */
+double VecteurMappe::dot(const VecteurMappe & _autre) const {
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+    }
+    return Noyaux::produitScalaire(donnees, _autre.donnees, dimension);
+}
+
+/** \brief Somme des lments (noyau SIMD `Noyaux::somme`).
+ */
+double VecteurMappe::somme() const {
+    return Noyaux::somme(donnees, dimension);
+}
+
+/** \brief Norme euclidienne (noyau SIMD `Noyaux::sommeCarres`).
+ */
+double VecteurMappe::norme() const {
+    return sqrt(Noyaux::sommeCarres(donnees, dimension));
+}
+
+size_t VecteurMappe::getDimension() const {
+    return dimension;
+}
+
+/** \brief Demande au systme de charger tout le fichier en mmoire ds maintenant, en arrire-plan (utile juste avant un parcours complet, pour
+ * ne pas attendre une lecture du disque  chaque nouvelle page). Sans effet si le systme ne le supporte pas.
+ */
+void VecteurMappe::precharger() const {
+#ifndef _WIN32
+    if (projection != nullptr){
+        madvise(projection, tailleProjection, MADV_WILLNEED);
+    }
+#endif
+}
@@ -0,0 +1,191 @@
+#include "InstrumentationVecteur.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /** \brief Compteurs d'une opration, aligns sur une ligne de cache (64 octets) pour que deux oprations ne partagent jamais la mme.
+     */
+    struct alignas(64) CompteursOperation
+    {
+        atomic<uint64_t> appels;
+        atomic<uint64_t> elements;
+        atomic<uint64_t> allocations;
+        atomic<uint64_t> octets;
+        atomic<uint64_t> nanosecondes;
+        atomic<uint64_t> histogramme[InstrumentationVecteur::NOMBRE_INTERVALLES];
+    };
+
+    // Variables globales  dure statique, initialises  zro avant toute excution: utilisables mme par des Vecteurs globaux.
+    CompteursOperation compteurs[InstrumentationVecteur::NOMBRE_OPERATIONS];
+
+    const char * const NOMS_OPERATIONS[InstrumentationVecteur::NOMBRE_OPERATIONS] = {
+        "Vecteur(const Vecteur &)",
+        "Vecteur(Vecteur &&)",
+        "Vecteur(dimension, valeur)",
+        "Vecteur(vector<double>)",
+        "Vecteur(intervalle)",
+        "Vecteur(istream)",
+        "Vecteur(expression)",
+        "operator=(const Vecteur &)",
+        "operator=(Vecteur &&)",
+        "operator=(expression)",
+        "operator+=",
+        "operator-=",
+        "operator+=(scalaire)",
+        "operator-=(scalaire)",
+        "operator*=(scalaire)",
+        "operator/=(scalaire)",
+        "dot",
+        "cross",
+        "exposant",
+        "exposantEnPlace",
+        "somme",
+        "prod",
+        "norme",
+        "logProd",
+        "toString",
+        "axpy",
+        "axpby",
+        "normaliser",
+        "dotEtNormes",
+        "distance"
+    };
+
+    /** \brief Intervalle de l'histogramme d'une dure: partie entire de log2(_nanosecondes), borne.
+     */
+    size_t intervalle(const uint64_t _nanosecondes){
+        size_t retour = 0;
+        for (uint64_t reste = _nanosecondes >> 1; reste != 0 && retour + 1 < InstrumentationVecteur::NOMBRE_INTERVALLES; reste >>= 1){
+            retour++;
+        }
+        return retour;
+    }
+
+    /** \brief Borne suprieure (en ns) de l'intervalle qui contient le percentile demand des appels.
+     */
+    uint64_t percentile(const InstrumentationVecteur::Statistiques & _statistiques, const double _fraction){
+        const double cible = _fraction * double(_statistiques.appels);
+        uint64_t cumul = 0;
+        for (size_t i = 0; i < InstrumentationVecteur::NOMBRE_INTERVALLES; i++){
+            cumul += _statistiques.histogramme[i];
+            if (double(cumul) >= cible){
+                return uint64_t(1) << (i + 1);
+            }
+        }
+        return uint64_t(1) << InstrumentationVecteur::NOMBRE_INTERVALLES;
+    }
+
+    /** \brief Oprations appeles au moins une fois, avec leurs compteurs.
+     */
+    vector<pair<InstrumentationVecteur::Operation, InstrumentationVecteur::Statistiques> > operationsAppelees(){
+        vector<pair<InstrumentationVecteur::Operation, InstrumentationVecteur::Statistiques> > retour;
+        for (size_t i = 0; i < InstrumentationVecteur::NOMBRE_OPERATIONS; i++){
+            const InstrumentationVecteur::Operation operation = InstrumentationVecteur::Operation(i);
+            const InstrumentationVecteur::Statistiques statistiques = InstrumentationVecteur::statistiques(operation);
+            if (statistiques.appels > 0){
+                retour.push_back(make_pair(operation, statistiques));
+            }
+        }
+        return retour;
+    }
+}
+
+const char * InstrumentationVecteur::nomOperation(const Operation _operation){
+    return _operation < NOMBRE_OPERATIONS ? NOMS_OPERATIONS[_operation] : "inconnue";
+}
+
+void InstrumentationVecteur::enregistrer(const Operation _operation, const uint64_t _elements, const uint64_t _allocations, const uint64_t _octets,
+                                         const uint64_t _nanosecondes){
+    CompteursOperation & compteursOperation = compteurs[_operation];
+    compteursOperation.appels.fetch_add(1, memory_order_relaxed);
+    compteursOperation.elements.fetch_add(_elements, memory_order_relaxed);
+    if (_allocations != 0){
+        compteursOperation.allocations.fetch_add(_allocations, memory_order_relaxed);
+    }
+    if (_octets != 0){
+        compteursOperation.octets.fetch_add(_octets, memory_order_relaxed);
+    }
+    compteursOperation.nanosecondes.fetch_add(_nanosecondes, memory_order_relaxed);
+    compteursOperation.histogramme[intervalle(_nanosecondes)].fetch_add(1, memory_order_relaxed);
+}
+
+InstrumentationVecteur::Statistiques InstrumentationVecteur::statistiques(const Operation _operation){
+    const CompteursOperation & compteursOperation = compteurs[_operation];
+    Statistiques retour;
+    retour.appels = compteursOperation.appels.load(memory_order_relaxed);
+    retour.elements = compteursOperation.elements.load(memory_order_relaxed);
+    retour.allocations = compteursOperation.allocations.load(memory_order_relaxed);
+    retour.octets = compteursOperation.octets.load(memory_order_relaxed);
+    retour.nanosecondes = compteursOperation.nanosecondes.load(memory_order_relaxed);
+    for (size_t i = 0; i < NOMBRE_INTERVALLES; i++){
+        retour.histogramme[i] = compteursOperation.histogramme[i].load(memory_order_relaxed);
+    }
+    return retour;
+}
+
+void InstrumentationVecteur::reinitialiser(){
+    for (size_t i = 0; i < NOMBRE_OPERATIONS; i++){
+        compteurs[i].appels.store(0, memory_order_relaxed);
+        compteurs[i].elements.store(0, memory_order_relaxed);
+        compteurs[i].allocations.store(0, memory_order_relaxed);
+        compteurs[i].octets.store(0, memory_order_relaxed);
+        compteurs[i].nanosecondes.store(0, memory_order_relaxed);
+        for (size_t j = 0; j < NOMBRE_INTERVALLES; j++){
+            compteurs[i].histogramme[j].store(0, memory_order_relaxed);
+        }
+    }
+}
+
+void InstrumentationVecteur::ecrireJson(ostream & _sortie){
+    const vector<pair<Operation, Statistiques> > operations = operationsAppelees();
+    _sortie << "{\n  \"instrumentation\": " << (estActive() ? "true" : "false") << ",\n  \"operations\": [";
+    for (size_t i = 0; i < operations.size(); i++){
+        const Statistiques & statistiques = operations[i].second;
+        _sortie << (i == 0 ? "\n" : ",\n") << "    {\"operation\": \"" << nomOperation(operations[i].first) << "\", \"appels\": "
+                << statistiques.appels << ", \"elements\": " << statistiques.elements << ", \"allocations\": " << statistiques.allocations
+                << ", \"octets\": " << statistiques.octets << ", \"nanosecondes\": " << statistiques.nanosecondes << ", \"histogramme_ns\": [";
+        // Histogramme tronqu aprs le dernier intervalle non vide.
+        size_t fin = NOMBRE_INTERVALLES;
+        while (fin > 0 && statistiques.histogramme[fin - 1] == 0){
+            fin--;
+        }
+        for (size_t j = 0; j < fin; j++){
+            _sortie << (j == 0 ? "" : ", ") << statistiques.histogramme[j];
+        }
+        _sortie << "]}";
+    }
+    _sortie << (operations.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+void InstrumentationVecteur::ecrireRapport(ostream & _sortie){
+    vector<pair<Operation, Statistiques> > operations = operationsAppelees();
+    sort(operations.begin(), operations.end(), [](const pair<Operation, Statistiques> & _a, const pair<Operation, Statistiques> & _b){
+        return _a.second.nanosecondes > _b.second.nanosecondes;
+    });
+    uint64_t total = 0;
+    for (size_t i = 0; i < operations.size(); i++){
+        total += operations[i].second.nanosecondes;
+    }
+    if (!estActive()){
+        _sortie << "# instrumentation inactive (compiler avec -DVECTEUR_INSTRUMENTATION)\n";
+    }
+    char ligne[256];
+    snprintf(ligne, sizeof(ligne), "# %7s %12s %14s %10s %10s %10s %14s %12s %12s  %s\n", "temps", "appels", "total (ns)", "ns/appel", "p50 (ns)",
+             "p99 (ns)", "elements", "allocations", "octets", "operation");
+    _sortie << ligne;
+    for (size_t i = 0; i < operations.size(); i++){
+        const Statistiques & statistiques = operations[i].second;
+        snprintf(ligne, sizeof(ligne), "  %6.2f%% %12llu %14llu %10.1f %10s %10s %14llu %12llu %12llu  %s\n",
+                 total > 0 ? 100.0 * double(statistiques.nanosecondes) / double(total) : 0.0, (unsigned long long)statistiques.appels,
+                 (unsigned long long)statistiques.nanosecondes, double(statistiques.nanosecondes) / double(statistiques.appels),
+                 ("<" + to_string(percentile(statistiques, 0.5))).c_str(), ("<" + to_string(percentile(statistiques, 0.99))).c_str(),
+                 (unsigned long long)statistiques.elements, (unsigned long long)statistiques.allocations, (unsigned long long)statistiques.octets,
+                 nomOperation(operations[i].first));
+        _sortie << ligne;
+    }
+}
@@ -0,0 +1,319 @@
+#include "Matrice.h"
+#include "Noyaux.h"
+
+#include <stdexcept>
+
+namespace
+{
+    // Colonnes par bloc pour produitTransposee: 512 doubles (4 Ko) du rsultat restent dans la cache L1.
+    const size_t COLONNES_PAR_BLOC = 512;
+
+    // Tuiles de produit(VecteurBatch): environ 128 Ko de lignes de la matrice, qui restent dans une cache L2 typique (256 Ko et plus), et 32 Ko
+    // de vecteurs du lot, qui restent dans la cache L1 (ou la L2).
+    const size_t OCTETS_PAR_TUILE = 128 * 1024;
+    const size_t OCTETS_PAR_TUILE_LOT = 32 * 1024;
+
+    // Ct des tuiles de transposee(): 32 x 32 doubles (8 Ko) lus et 8 Ko crits.
+    const size_t COTE_TUILE_TRANSPOSEE = 32;
+}
+
+/** \brief Constructeur de la classe Matrice. Cre une matrice `_nombreLignes` x `_nombreColonnes` remplie avec `_valeurInitiale`.
+ * \param _nombreLignes: nombre de lignes.
+ * \param _nombreColonnes: nombre de colonnes.
+ * \param _valeurInitiale: valeur donne  chaque lment.
+ */
+Matrice::Matrice(const size_t _nombreLignes, const size_t _nombreColonnes, const double _valeurInitiale)
+    : lignes(_nombreLignes, _nombreColonnes, _valeurInitiale)
+{
+}
+
+/** \brief Variante du constructeur: chaque Vecteur devient une ligne.
+ * \param _lignes: lignes de la matrice, toutes de mme dimension.
+ */
+Matrice::Matrice(const vector<Vecteur> & _lignes)
+    : lignes(_lignes)
+{
+}
+
+/** \brief Variante du constructeur: chaque ligne du lot devient une ligne de la matrice.
+ * \param _lignes: lot copi (ou dont on prend la mmoire, pour la version par dplacement).
+ */
+Matrice::Matrice(const VecteurBatch & _lignes)
+    : lignes(_lignes)
+{
+}
+
+Matrice::Matrice(VecteurBatch && _lignes)
+    : lignes(move(_lignes))
+{
+}
+
+/** \brief Matrice identit.
+ * \param _taille: nombre de lignes et de colonnes.
+ * \return La matrice `_taille` x `_taille` avec des 1 sur la diagonale et des 0 ailleurs.
+ */
+Matrice Matrice::identite(const size_t _taille){
+    Matrice retour(_taille, _taille);
+    for (size_t i = 0; i < _taille; i++){
+        retour.lignes(i, i) = 1;
+    }
+    return retour;
+}
+
+/** \brief Produit extrieur u v^T: l'lment (i, j) vaut `_u[i] * _v[j]` (un seul arrondi, comme l'oprateur *).
+ * \param _u: Vecteur de dimension m (nombre de lignes).
+ * \param _v: Vecteur de dimension n (nombre de colonnes).
+ * \param _politique: politique d'excution (les lignes sont rparties entre les fils).
+ * \return La matrice m x n.
+ */
+Matrice Matrice::produitExterieur(const Vecteur & _u, const Vecteur & _v, const PolitiqueExecution & _politique){
+    const size_t nombreLignes = _u.getDimension();
+    const size_t nombreColonnes = _v.getDimension();
+    Matrice retour(nombreLignes, nombreColonnes);
+    double * donnees = retour.lignes.data();
+    const size_t pas = retour.lignes.getPas();
+    const double * u = _u.data();
+    const double * v = _v.data();
+    Parallele::pourChaqueMorceau(nombreLignes, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t i = _debut; i < _fin; i++){
+            double * ligne = donnees + i * pas;
+            for (size_t j = 0; j < nombreColonnes; j++){
+                ligne[j] = v[j];
+            }
+            Noyaux::multiplierScalaire(ligne, u[i], nombreColonnes);
+        }
+    }, nombreColonnes);
+    return retour;
+}
+
+/** \brief Accs  un lment, en lecture et en criture.
+ * \param _ligne: index de la ligne.
+ * \param _colonne: index de la colonne.
+ * \return La rfrence vers l'lment.
+ */
+double & Matrice::operator()(const size_t _ligne, const size_t _colonne){
+    return lignes(_ligne, _colonne);
+}
+
+double Matrice::operator()(const size_t _ligne, const size_t _colonne) const {
+    return lignes(_ligne, _colonne);
+}
+
+/** \brief Copie une ligne dans un nouveau Vecteur.
+ * \param _ligne: index de la ligne.
+ * \return Le Vecteur de dimension `getNombreColonnes()`.
+ */
+Vecteur Matrice::ligne(const size_t _ligne) const {
+    return lignes.extraire(_ligne);
+}
+
+/** \brief Copie une colonne dans un nouveau Vecteur.
+ * \param _colonne: index de la colonne.
+ * \return Le Vecteur de dimension `getNombreLignes()`.
+ */
+Vecteur Matrice::colonne(const size_t _colonne) const {
+    return Vecteur(lignes.vueColonne(_colonne));
+}
+
+/** \brief Vue (sans copie) sur une ligne ou une colonne (voir VecteurBatch::vueLigne et VecteurBatch::vueColonne).
+ */
+VecteurVue Matrice::vueLigne(const size_t _ligne){
+    return lignes.vueLigne(_ligne);
+}
+
+VecteurVueConst Matrice::vueLigne(const size_t _ligne) const {
+    return lignes.vueLigne(_ligne);
+}
+
+VecteurVue Matrice::vueColonne(const size_t _colonne){
+    return lignes.vueColonne(_colonne);
+}
+
+VecteurVueConst Matrice::vueColonne(const size_t _colonne) const {
+    return lignes.vueColonne(_colonne);
+}
+
+/** \brief Remplace les valeurs d'une ligne par celles d'un Vecteur.
+ * \param _ligne: index de la ligne.
+ * \param _valeurs: Vecteur de dimension `getNombreColonnes()`.
+ */
+void Matrice::definirLigne(const size_t _ligne, const Vecteur & _valeurs){
+    lignes.definir(_ligne, _valeurs);
+}
+
+/** \brief Lignes de la matrice, sous forme de lot (par exemple pour RechercheVoisins).
+ */
+const VecteurBatch & Matrice::getLignes() const {
+    return lignes;
+}
+
+/** \brief Produit matrice-vecteur A x. Les lignes sont traites par groupes de 4 (voir Noyaux::produitsScalairesLignes).
+ * \param _x: Vecteur de dimension `getNombreColonnes()`.
+ * \param _politique: politique d'excution (les groupes de lignes sont rpartis entre les fils).
+ * \return Le Vecteur de dimension `getNombreLignes()` dont l'lment i est le produit scalaire de la ligne i avec `_x`.
+ */
+Vecteur Matrice::produit(const Vecteur & _x, const PolitiqueExecution & _politique) const {
+    const size_t nombreColonnes = lignes.getDimension();
+    if (_x.getDimension() != nombreColonnes){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit matrice-vecteur.");
+    }
+    const size_t nombreLignes = lignes.getNombreLignes();
+    Vecteur retour(nombreLignes, 0.0);
+    const double * donnees = lignes.data();
+    const size_t pas = lignes.getPas();
+    const double * x = _x.data();
+    double * resultats = retour.data();
+    // On dcoupe par groupes de 4 lignes: les groupes sont les mmes qu'en squentiel, donc le rsultat aussi.
+    const size_t nombreGroupes = (nombreLignes + 3) / 4;
+    Parallele::pourChaqueMorceau(nombreGroupes, _politique, [&](const size_t _debut, const size_t _fin){
+        const size_t debut = 4 * _debut;
+        const size_t fin = 4 * _fin < nombreLignes ? 4 * _fin : nombreLignes;
+        Noyaux::produitsScalairesLignes(donnees + debut * pas, pas, fin - debut, x, nombreColonnes, 1, nombreColonnes, resultats + debut, 0);
+    }, 4 * nombreColonnes);
+    return retour;
+}
+
+/** \brief Produit vecteur-matrice x^T A (ou A^T x): combinaison des lignes de la matrice, pondres par les lments de `_x`. Les colonnes sont
+ * coupes en blocs qui restent dans la cache L1 (voir Noyaux::combinaisonLignes).
+ * \param _x: Vecteur de dimension `getNombreLignes()`.
+ * \param _politique: politique d'excution (les blocs de colonnes sont rpartis entre les fils).
+ * \return Le Vecteur de dimension `getNombreColonnes()` dont l'lment j est le produit scalaire de la colonne j avec `_x`.
+ */
+Vecteur Matrice::produitTransposee(const Vecteur & _x, const PolitiqueExecution & _politique) const {
+    const size_t nombreLignes = lignes.getNombreLignes();
+    if (_x.getDimension() != nombreLignes){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit vecteur-matrice.");
+    }
+    const size_t nombreColonnes = lignes.getDimension();
+    Vecteur retour(nombreColonnes, 0.0);
+    const double * donnees = lignes.data();
+    const size_t pas = lignes.getPas();
+    const double * x = _x.data();
+    double * resultats = retour.data();
+    const size_t nombreBlocs = (nombreColonnes + COLONNES_PAR_BLOC - 1) / COLONNES_PAR_BLOC;
+    Parallele::pourChaqueMorceau(nombreBlocs, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t bloc = _debut; bloc < _fin; bloc++){
+            const size_t debut = bloc * COLONNES_PAR_BLOC;
+            const size_t fin = debut + COLONNES_PAR_BLOC < nombreColonnes ? debut + COLONNES_PAR_BLOC : nombreColonnes;
+            Noyaux::combinaisonLignes(resultats + debut, donnees + debut, pas, nombreLignes, x, fin - debut);
+        }
+    }, COLONNES_PAR_BLOC * nombreLignes);
+    return retour;
+}
+
+/** \brief Applique la matrice  chacun des vecteurs d'un lot: la ligne j du rsultat est A x_j, o x_j est la ligne j du lot. Les lignes de la
+ * matrice sont coupes en tuiles (un multiple de 4 lignes, environ 128 Ko) qui restent dans la cache L2 pendant qu'on y passe tous les
+ * vecteurs du lot, par tuiles de 32 Ko. Dans une tuile, les produits sont calculs par blocs de 4 lignes x 4 vecteurs gards dans les
+ * registres (voir Noyaux::produitsScalairesLignes).
+ * \param _vecteurs: lot de vecteurs de dimension `getNombreColonnes()`.
+ * \param _politique: politique d'excution (les vecteurs du lot sont rpartis entre les fils).
+ * \return Un lot de `_vecteurs.getNombreLignes()` lignes de dimension `getNombreLignes()`.
+ */
+VecteurBatch Matrice::produit(const VecteurBatch & _vecteurs, const PolitiqueExecution & _politique) const {
+    const size_t nombreColonnes = lignes.getDimension();
+    if (_vecteurs.getDimension() != nombreColonnes){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit matrice-vecteur.");
+    }
+    const size_t nombreLignes = lignes.getNombreLignes();
+    const size_t nombreVecteurs = _vecteurs.getNombreLignes();
+    VecteurBatch retour(nombreVecteurs, nombreLignes);
+    const double * donnees = lignes.data();
+    const size_t pas = lignes.getPas();
+    const double * entrees = _vecteurs.data();
+    const size_t pasEntrees = _vecteurs.getPas();
+    double * sorties = retour.data();
+    const size_t pasSorties = retour.getPas();
+    // Tuile de la matrice: multiple de 4 lignes, pour que les groupes de 4 lignes soient les mmes que dans produit(Vecteur).
+    const size_t octetsParLigne = (pas > 0 ? pas : 1) * sizeof(double);
+    const size_t lignesParTuile = OCTETS_PAR_TUILE / octetsParLigne >= 4 ? OCTETS_PAR_TUILE / octetsParLigne / 4 * 4 : 4;
+    const size_t octetsParVecteur = (pasEntrees > 0 ? pasEntrees : 1) * sizeof(double);
+    const size_t vecteursParTuile = OCTETS_PAR_TUILE_LOT / octetsParVecteur >= 4 ? OCTETS_PAR_TUILE_LOT / octetsParVecteur : 4;
+    Parallele::pourChaqueMorceau(nombreVecteurs, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t debutTuile = 0; debutTuile < nombreLignes; debutTuile += lignesParTuile){
+            const size_t finTuile = debutTuile + lignesParTuile < nombreLignes ? debutTuile + lignesParTuile : nombreLignes;
+            for (size_t debutLot = _debut; debutLot < _fin; debutLot += vecteursParTuile){
+                const size_t finLot = debutLot + vecteursParTuile < _fin ? debutLot + vecteursParTuile : _fin;
+                Noyaux::produitsScalairesLignes(donnees + debutTuile * pas, pas, finTuile - debutTuile, entrees + debutLot * pasEntrees, pasEntrees,
+                                                finLot - debutLot, nombreColonnes, sorties + debutLot * pasSorties + debutTuile, pasSorties);
+            }
+        }
+    }, nombreLignes * nombreColonnes);
+    return retour;
+}
+
+/** \brief Mise  jour de rang 1: A += alpha u v^T. Chaque ligne i reoit `axpy(alpha * u[i], v)`: le coefficient est arrondi une fois, puis
+ * chaque lment est une FMA (voir Noyaux::axpy).
+ * \param _alpha: facteur du produit extrieur.
+ * \param _u: Vecteur de dimension `getNombreLignes()`.
+ * \param _v: Vecteur de dimension `getNombreColonnes()`.
+ * \param _politique: politique d'excution (les lignes sont rparties entre les fils).
+ * \return *this, le pointeur de l'objet courant drfrenc.
+ */
+Matrice & Matrice::ajouterProduitExterieur(const double _alpha, const Vecteur & _u, const Vecteur & _v, const PolitiqueExecution & _politique){
+    const size_t nombreLignes = lignes.getNombreLignes();
+    const size_t nombreColonnes = lignes.getDimension();
+    if (_u.getDimension() != nombreLignes || _v.getDimension() != nombreColonnes){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit extrieur.");
+    }
+    double * donnees = lignes.data();
+    const size_t pas = lignes.getPas();
+    const double * u = _u.data();
+    const double * v = _v.data();
+    Parallele::pourChaqueMorceau(nombreLignes, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t i = _debut; i < _fin; i++){
+            Noyaux::axpy(donnees + i * pas, _alpha * u[i], v, nombreColonnes);
+        }
+    }, nombreColonnes);
+    return *this;
+}
+
+/** \brief Transpose de la matrice, copie par tuiles carres (les lectures et les critures d'une tuile restent dans la cache L1).
+ * \return La matrice `getNombreColonnes()` x `getNombreLignes()`.
+ */
+Matrice Matrice::transposee() const {
+    const size_t nombreLignes = lignes.getNombreLignes();
+    const size_t nombreColonnes = lignes.getDimension();
+    Matrice retour(nombreColonnes, nombreLignes);
+    const double * source = lignes.data();
+    const size_t pasSource = lignes.getPas();
+    double * destination = retour.lignes.data();
+    const size_t pasDestination = retour.lignes.getPas();
+    for (size_t debutI = 0; debutI < nombreLignes; debutI += COTE_TUILE_TRANSPOSEE){
+        const size_t finI = debutI + COTE_TUILE_TRANSPOSEE < nombreLignes ? debutI + COTE_TUILE_TRANSPOSEE : nombreLignes;
+        for (size_t debutJ = 0; debutJ < nombreColonnes; debutJ += COTE_TUILE_TRANSPOSEE){
+            const size_t finJ = debutJ + COTE_TUILE_TRANSPOSEE < nombreColonnes ? debutJ + COTE_TUILE_TRANSPOSEE : nombreColonnes;
+            for (size_t i = debutI; i < finI; i++){
+                for (size_t j = debutJ; j < finJ; j++){
+                    destination[j * pasDestination + i] = source[i * pasSource + j];
+                }
+            }
+        }
+    }
+    return retour;
+}
+
+size_t Matrice::getNombreLignes() const {
+    return lignes.getNombreLignes();
+}
+
+size_t Matrice::getNombreColonnes() const {
+    return lignes.getDimension();
+}
+
+/** \brief Distance (en nombre de doubles) entre le dbut de deux lignes conscutives (voir VecteurBatch::getPas).
+ */
+size_t Matrice::getPas() const {
+    return lignes.getPas();
+}
+
+/** \brief Produit matrice-vecteur A x (squentiel), voir Matrice::produit.
+ */
+Vecteur operator*(const Matrice & _matrice, const Vecteur & _x){
+    return _matrice.produit(_x);
+}
+
+/** \brief Produit vecteur-matrice x^T A (squentiel), voir Matrice::produitTransposee.
+ */
+Vecteur operator*(const Vecteur & _x, const Matrice & _matrice){
+    return _matrice.produitTransposee(_x);
+}
@@ -0,0 +1,29 @@
+#include "MemoireVecteur.h"
+
+namespace
+{
+    // Ressource choisie pour le fil courant (nullptr: la ressource par dfaut de la bibliothque standard, soit new/delete).
+    thread_local pmr::memory_resource * ressourceDuFil = nullptr;
+}
+
+/** \brief Constructeur.  partir de maintenant et jusqu' la destruction de l'objet, les Vecteurs crs sur ce fil allouent dans `_ressource`.
+ * \param _ressource: ressource  utiliser (nullptr pour revenir  la ressource par dfaut).
+ */
+PorteeMemoire::PorteeMemoire(pmr::memory_resource * _ressource)
+    : precedente(ressourceDuFil)
+{
+    ressourceDuFil = _ressource;
+}
+
+/** \brief Destructeur. Rtablit la ressource qui tait utilise avant (les portes peuvent donc s'imbriquer).
+ */
+PorteeMemoire::~PorteeMemoire()
+{
+    ressourceDuFil = precedente;
+}
+
+/** \brief Ressource mmoire  utiliser pour un nouveau Vecteur cr sur le fil courant.
+ */
+pmr::memory_resource * PorteeMemoire::ressourceCourante(){
+    return ressourceDuFil != nullptr ? ressourceDuFil : pmr::get_default_resource();
+}
@@ -0,0 +1,1592 @@
+#include "Noyaux.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NOYAUX_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    /** \brief Table des pointeurs de fonctions d'un jeu d'instructions. Les fonctions publiques du namespace Noyaux passent par la table courante.
+     */
+    struct TableNoyaux
+    {
+        Noyaux::JeuInstructions jeu;
+        double (*produitScalaire)(const double *, const double *, const size_t);
+        double (*somme)(const double *, const size_t);
+        double (*produit)(const double *, const size_t);
+        double (*sommeCarres)(const double *, const size_t);
+        void (*ajouter)(double *, const double *, const size_t);
+        void (*soustraire)(double *, const double *, const size_t);
+        void (*ajouterScalaire)(double *, const double, const size_t);
+        void (*multiplierScalaire)(double *, const double, const size_t);
+        void (*diviserScalaire)(double *, const double, const size_t);
+    };
+
+    // Version portable (scalaire, sans intrinsques). Les rductions utilisent quand mme 4 accumulateurs indpendants pour briser la chane de
+    // dpendances entre les additions.
+
+    double produitScalairePortable(const double * _a, const double * _b, const size_t _taille){
+        double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            s0 += _a[i] * _b[i];
+            s1 += _a[i + 1] * _b[i + 1];
+            s2 += _a[i + 2] * _b[i + 2];
+            s3 += _a[i + 3] * _b[i + 3];
+        }
+        for (; i < _taille; i++){
+            s0 += _a[i] * _b[i];
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    double sommePortable(const double * _a, const size_t _taille){
+        double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            s0 += _a[i];
+            s1 += _a[i + 1];
+            s2 += _a[i + 2];
+            s3 += _a[i + 3];
+        }
+        for (; i < _taille; i++){
+            s0 += _a[i];
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    double produitPortable(const double * _a, const size_t _taille){
+        double p0 = 1, p1 = 1, p2 = 1, p3 = 1;
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            p0 *= _a[i];
+            p1 *= _a[i + 1];
+            p2 *= _a[i + 2];
+            p3 *= _a[i + 3];
+        }
+        for (; i < _taille; i++){
+            p0 *= _a[i];
+        }
+        return (p0 * p1) * (p2 * p3);
+    }
+
+    double sommeCarresPortable(const double * _a, const size_t _taille){
+        return produitScalairePortable(_a, _a, _taille);
+    }
+
+    void ajouterPortable(double * _destination, const double * _source, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _destination[i] += _source[i];
+        }
+    }
+
+    void soustrairePortable(double * _destination, const double * _source, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _destination[i] -= _source[i];
+        }
+    }
+
+    void ajouterScalairePortable(double * _destination, const double _scalaire, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _destination[i] += _scalaire;
+        }
+    }
+
+    void multiplierScalairePortable(double * _destination, const double _scalaire, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _destination[i] *= _scalaire;
+        }
+    }
+
+    void diviserScalairePortable(double * _destination, const double _scalaire, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _destination[i] /= _scalaire;
+        }
+    }
+
+    const TableNoyaux tablePortable = {
+        Noyaux::SCALAIRE, produitScalairePortable, sommePortable, produitPortable, sommeCarresPortable,
+        ajouterPortable, soustrairePortable, ajouterScalairePortable, multiplierScalairePortable, diviserScalairePortable
+    };
+
+#ifdef NOYAUX_X86
+
+/* Versions SIMD. Le corps des noyaux est identique d'un jeu d'instructions  l'autre: seuls le type de registre, sa largeur (nombre de doubles) et
+ * les intrinsques changent. On les gnre donc avec une macro, compile chaque fois avec l'attribut `target(...)` correspondant. Ainsi, le reste du
+ * programme n'a pas besoin d'tre compil avec -mavx2 (ou autre): on choisit la bonne version  l'excution.
+ * Les rductions utilisent 4 registres accumulateurs (4 * LARGEUR sommes partielles), puis un registre seul pour le reste, puis une boucle scalaire.
+ */
+#define DEFINIR_NOYAUX_SIMD(SUFFIXE, CIBLE, TYPE, LARGEUR, CHARGER, STOCKER, ADDITION, SOUSTRACTION, MULTIPLICATION, DIVISION, DIFFUSER)    \
+    __attribute__((target(CIBLE))) double produitScalaire##SUFFIXE(const double * _a, const double * _b, const size_t _taille){             \
+        TYPE s0 = DIFFUSER(0.0), s1 = DIFFUSER(0.0), s2 = DIFFUSER(0.0), s3 = DIFFUSER(0.0);                                                \
+        size_t i = 0;                                                                                                                        \
+        for (; i + 4 * LARGEUR <= _taille; i += 4 * LARGEUR){                                                                                \
+            s0 = ADDITION(s0, MULTIPLICATION(CHARGER(_a + i), CHARGER(_b + i)));                                                             \
+            s1 = ADDITION(s1, MULTIPLICATION(CHARGER(_a + i + LARGEUR), CHARGER(_b + i + LARGEUR)));                                         \
+            s2 = ADDITION(s2, MULTIPLICATION(CHARGER(_a + i + 2 * LARGEUR), CHARGER(_b + i + 2 * LARGEUR)));                                 \
+            s3 = ADDITION(s3, MULTIPLICATION(CHARGER(_a + i + 3 * LARGEUR), CHARGER(_b + i + 3 * LARGEUR)));                                 \
+        }                                                                                                                                    \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            s0 = ADDITION(s0, MULTIPLICATION(CHARGER(_a + i), CHARGER(_b + i)));                                                             \
+        }                                                                                                                                    \
+        double partielles[LARGEUR];                                                                                                          \
+        STOCKER(partielles, ADDITION(ADDITION(s0, s1), ADDITION(s2, s3)));                                                                   \
+        double retour = 0;                                                                                                                   \
+        for (size_t j = 0; j < LARGEUR; j++){                                                                                                \
+            retour += partielles[j];                                                                                                         \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            retour += _a[i] * _b[i];                                                                                                         \
+        }                                                                                                                                    \
+        return retour;                                                                                                                       \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) double somme##SUFFIXE(const double * _a, const size_t _taille){                                           \
+        TYPE s0 = DIFFUSER(0.0), s1 = DIFFUSER(0.0), s2 = DIFFUSER(0.0), s3 = DIFFUSER(0.0);                                                \
+        size_t i = 0;                                                                                                                        \
+        for (; i + 4 * LARGEUR <= _taille; i += 4 * LARGEUR){                                                                                \
+            s0 = ADDITION(s0, CHARGER(_a + i));                                                                                              \
+            s1 = ADDITION(s1, CHARGER(_a + i + LARGEUR));                                                                                    \
+            s2 = ADDITION(s2, CHARGER(_a + i + 2 * LARGEUR));                                                                                \
+            s3 = ADDITION(s3, CHARGER(_a + i + 3 * LARGEUR));                                                                                \
+        }                                                                                                                                    \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            s0 = ADDITION(s0, CHARGER(_a + i));                                                                                              \
+        }                                                                                                                                    \
+        double partielles[LARGEUR];                                                                                                          \
+        STOCKER(partielles, ADDITION(ADDITION(s0, s1), ADDITION(s2, s3)));                                                                   \
+        double retour = 0;                                                                                                                   \
+        for (size_t j = 0; j < LARGEUR; j++){                                                                                                \
+            retour += partielles[j];                                                                                                         \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            retour += _a[i];                                                                                                                 \
+        }                                                                                                                                    \
+        return retour;                                                                                                                       \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) double produit##SUFFIXE(const double * _a, const size_t _taille){                                         \
+        TYPE p0 = DIFFUSER(1.0), p1 = DIFFUSER(1.0), p2 = DIFFUSER(1.0), p3 = DIFFUSER(1.0);                                                \
+        size_t i = 0;                                                                                                                        \
+        for (; i + 4 * LARGEUR <= _taille; i += 4 * LARGEUR){                                                                                \
+            p0 = MULTIPLICATION(p0, CHARGER(_a + i));                                                                                        \
+            p1 = MULTIPLICATION(p1, CHARGER(_a + i + LARGEUR));                                                                              \
+            p2 = MULTIPLICATION(p2, CHARGER(_a + i + 2 * LARGEUR));                                                                          \
+            p3 = MULTIPLICATION(p3, CHARGER(_a + i + 3 * LARGEUR));                                                                          \
+        }                                                                                                                                    \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            p0 = MULTIPLICATION(p0, CHARGER(_a + i));                                                                                        \
+        }                                                                                                                                    \
+        double partiels[LARGEUR];                                                                                                            \
+        STOCKER(partiels, MULTIPLICATION(MULTIPLICATION(p0, p1), MULTIPLICATION(p2, p3)));                                                   \
+        double retour = 1;                                                                                                                   \
+        for (size_t j = 0; j < LARGEUR; j++){                                                                                                \
+            retour *= partiels[j];                                                                                                           \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            retour *= _a[i];                                                                                                                 \
+        }                                                                                                                                    \
+        return retour;                                                                                                                       \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) double sommeCarres##SUFFIXE(const double * _a, const size_t _taille){                                     \
+        return produitScalaire##SUFFIXE(_a, _a, _taille);                                                                                    \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) void ajouter##SUFFIXE(double * _destination, const double * _source, const size_t _taille){               \
+        size_t i = 0;                                                                                                                        \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            STOCKER(_destination + i, ADDITION(CHARGER(_destination + i), CHARGER(_source + i)));                                            \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            _destination[i] += _source[i];                                                                                                   \
+        }                                                                                                                                    \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) void soustraire##SUFFIXE(double * _destination, const double * _source, const size_t _taille){            \
+        size_t i = 0;                                                                                                                        \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            STOCKER(_destination + i, SOUSTRACTION(CHARGER(_destination + i), CHARGER(_source + i)));                                        \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            _destination[i] -= _source[i];                                                                                                   \
+        }                                                                                                                                    \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) void ajouterScalaire##SUFFIXE(double * _destination, const double _scalaire, const size_t _taille){       \
+        const TYPE scalaire = DIFFUSER(_scalaire);                                                                                           \
+        size_t i = 0;                                                                                                                        \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            STOCKER(_destination + i, ADDITION(CHARGER(_destination + i), scalaire));                                                        \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            _destination[i] += _scalaire;                                                                                                    \
+        }                                                                                                                                    \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) void multiplierScalaire##SUFFIXE(double * _destination, const double _scalaire, const size_t _taille){    \
+        const TYPE scalaire = DIFFUSER(_scalaire);                                                                                           \
+        size_t i = 0;                                                                                                                        \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            STOCKER(_destination + i, MULTIPLICATION(CHARGER(_destination + i), scalaire));                                                  \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            _destination[i] *= _scalaire;                                                                                                    \
+        }                                                                                                                                    \
+    }                                                                                                                                        \
+                                                                                                                                             \
+    __attribute__((target(CIBLE))) void diviserScalaire##SUFFIXE(double * _destination, const double _scalaire, const size_t _taille){       \
+        const TYPE scalaire = DIFFUSER(_scalaire);                                                                                           \
+        size_t i = 0;                                                                                                                        \
+        for (; i + LARGEUR <= _taille; i += LARGEUR){                                                                                        \
+            STOCKER(_destination + i, DIVISION(CHARGER(_destination + i), scalaire));                                                        \
+        }                                                                                                                                    \
+        for (; i < _taille; i++){                                                                                                            \
+            _destination[i] /= _scalaire;                                                                                                    \
+        }                                                                                                                                    \
+    }
+
+    DEFINIR_NOYAUX_SIMD(SSE2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_div_pd, _mm_set1_pd)
+    DEFINIR_NOYAUX_SIMD(AVX2, "avx2", __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_div_pd,
+                        _mm256_set1_pd)
+    DEFINIR_NOYAUX_SIMD(AVX512, "avx512f", __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd,
+                        _mm512_div_pd, _mm512_set1_pd)
+
+#undef DEFINIR_NOYAUX_SIMD
+
+    const TableNoyaux tableSSE2 = {
+        Noyaux::SSE2, produitScalaireSSE2, sommeSSE2, produitSSE2, sommeCarresSSE2,
+        ajouterSSE2, soustraireSSE2, ajouterScalaireSSE2, multiplierScalaireSSE2, diviserScalaireSSE2
+    };
+
+    const TableNoyaux tableAVX2 = {
+        Noyaux::AVX2, produitScalaireAVX2, sommeAVX2, produitAVX2, sommeCarresAVX2,
+        ajouterAVX2, soustraireAVX2, ajouterScalaireAVX2, multiplierScalaireAVX2, diviserScalaireAVX2
+    };
+
+    const TableNoyaux tableAVX512 = {
+        Noyaux::AVX512, produitScalaireAVX512, sommeAVX512, produitAVX512, sommeCarresAVX512,
+        ajouterAVX512, soustraireAVX512, ajouterScalaireAVX512, multiplierScalaireAVX512, diviserScalaireAVX512
+    };
+
+#endif // NOYAUX_X86
+
+    // Noyaux pour lments compacts. `versDouble` convertit un lment (sans perte) pour les boucles scalaires et la fin des boucles SIMD.
+
+    inline double versDouble(const float _valeur){
+        return _valeur;
+    }
+
+    inline double versDouble(const uint16_t _bfloat16){
+        const uint32_t bits = uint32_t(_bfloat16) << 16;
+        float valeur;
+        memcpy(&valeur, &bits, sizeof(valeur));
+        return valeur;
+    }
+
+    template <typename T>
+    double produitScalaireCompactPortable(const T * _a, const T * _b, const size_t _taille){
+        double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            s0 += versDouble(_a[i]) * versDouble(_b[i]);
+            s1 += versDouble(_a[i + 1]) * versDouble(_b[i + 1]);
+            s2 += versDouble(_a[i + 2]) * versDouble(_b[i + 2]);
+            s3 += versDouble(_a[i + 3]) * versDouble(_b[i + 3]);
+        }
+        for (; i < _taille; i++){
+            s0 += versDouble(_a[i]) * versDouble(_b[i]);
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    template <typename T>
+    double sommeCompactPortable(const T * _a, const size_t _taille){
+        double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            s0 += versDouble(_a[i]);
+            s1 += versDouble(_a[i + 1]);
+            s2 += versDouble(_a[i + 2]);
+            s3 += versDouble(_a[i + 3]);
+        }
+        for (; i < _taille; i++){
+            s0 += versDouble(_a[i]);
+        }
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    int64_t produitScalaireInt8Portable(const int8_t * _a, const int8_t * _b, const size_t _taille){
+        int64_t retour = 0;
+        for (size_t i = 0; i < _taille; i++){
+            retour += int32_t(_a[i]) * int32_t(_b[i]);
+        }
+        return retour;
+    }
+
+    int64_t sommeInt8Portable(const int8_t * _a, const size_t _taille){
+        int64_t retour = 0;
+        for (size_t i = 0; i < _taille; i++){
+            retour += _a[i];
+        }
+        return retour;
+    }
+
+    // Rductions compenses (voir Noyaux::COMPENSEE). `deuxSommes` ajoute `_x`  `_somme` et accumule l'erreur d'arrondi exacte de cette addition
+    // dans `_correction` (algorithme TwoSum de Knuth: mme rsultat que le test de Neumaier sur |_somme| >= |_x|, mais sans branchement, ce qui
+    // permet de le vectoriser). Le compilateur ne doit pas rassocier ces oprations: ne pas compiler ce fichier avec -ffast-math.
+
+    inline void deuxSommes(double & _somme, double & _correction, const double _x){
+        const double total = _somme + _x;
+        const double z = total - _somme;
+        _correction += (_somme - (total - z)) + (_x - z);
+        _somme = total;
+    }
+
+    /** \brief Combine les voies (sommes et corrections) d'un noyau compens, puis ajoute la fin du tableau. Si la somme n'est pas finie (infini ou
+     * NaN dans les donnes, ou dpassement), la correction n'a pas de sens: on retourne la somme ordinaire, comme le ferait le noyau RAPIDE.
+     */
+    double combinerVoiesCompensees(const double * _sommes, const double * _corrections, const size_t _voies, const double * _a, const double * _b,
+                                   const size_t _taille){
+        double somme = 0, correction = 0;
+        for (size_t j = 0; j < _voies; j++){
+            deuxSommes(somme, correction, _sommes[j]);
+            correction += _corrections[j];
+        }
+        for (size_t i = 0; i < _taille; i++){
+            if (_b == nullptr){
+                deuxSommes(somme, correction, _a[i]);
+            }
+            else {
+                const double terme = _a[i] * _b[i];
+                deuxSommes(somme, correction, terme);
+                correction += fma(_a[i], _b[i], -terme);
+            }
+        }
+        return isfinite(somme) ? somme + correction : somme;
+    }
+
+    double sommeCompenseePortable(const double * _a, const size_t _taille){
+        double sommes[4] = {0, 0, 0, 0}, corrections[4] = {0, 0, 0, 0};
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            for (size_t j = 0; j < 4; j++){
+                deuxSommes(sommes[j], corrections[j], _a[i + j]);
+            }
+        }
+        return combinerVoiesCompensees(sommes, corrections, 4, _a + i, nullptr, _taille - i);
+    }
+
+    double produitScalaireCompensePortable(const double * _a, const double * _b, const size_t _taille){
+        return combinerVoiesCompensees(nullptr, nullptr, 0, _a, _b, _taille);
+    }
+
+    // Niveau 1 de BLAS (voir Noyaux::axpy): chaque produit-addition est une FMA (un seul arrondi). `fma` utilise l'instruction du processeur
+    // quand elle existe; sinon, elle est mule (exacte, mais lente).
+
+    void axpyPortable(double * _y, const double _a, const double * _x, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _y[i] = fma(_a, _x[i], _y[i]);
+        }
+    }
+
+    void axpbyPortable(double * _y, const double _a, const double * _x, const double _b, const size_t _taille){
+        for (size_t i = 0; i < _taille; i++){
+            _y[i] = fma(_a, _x[i], _b * _y[i]);
+        }
+    }
+
+    double produitScalaireEtSommesCarresPortable(const double * _a, const double * _b, const size_t _taille, double & _carresA, double & _carresB){
+        double produits[4] = {0, 0, 0, 0}, carresA[4] = {0, 0, 0, 0}, carresB[4] = {0, 0, 0, 0};
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            for (size_t j = 0; j < 4; j++){
+                produits[j] = fma(_a[i + j], _b[i + j], produits[j]);
+                carresA[j] = fma(_a[i + j], _a[i + j], carresA[j]);
+                carresB[j] = fma(_b[i + j], _b[i + j], carresB[j]);
+            }
+        }
+        for (; i < _taille; i++){
+            produits[0] = fma(_a[i], _b[i], produits[0]);
+            carresA[0] = fma(_a[i], _a[i], carresA[0]);
+            carresB[0] = fma(_b[i], _b[i], carresB[0]);
+        }
+        _carresA = (carresA[0] + carresA[1]) + (carresA[2] + carresA[3]);
+        _carresB = (carresB[0] + carresB[1]) + (carresB[2] + carresB[3]);
+        return (produits[0] + produits[1]) + (produits[2] + produits[3]);
+    }
+
+    double distanceCarreePortable(const double * _a, const double * _b, const size_t _taille){
+        double sommes[4] = {0, 0, 0, 0};
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            for (size_t j = 0; j < 4; j++){
+                const double difference = _a[i + j] - _b[i + j];
+                sommes[j] = fma(difference, difference, sommes[j]);
+            }
+        }
+        for (; i < _taille; i++){
+            const double difference = _a[i] - _b[i];
+            sommes[0] = fma(difference, difference, sommes[0]);
+        }
+        return (sommes[0] + sommes[1]) + (sommes[2] + sommes[3]);
+    }
+
+    // Niveau 2 de BLAS (voir Noyaux::produitsScalairesLignes): bloc de 4 lignes x V vecteurs, un accumulateur par paire (ligne, vecteur). Comme
+    // `produitScalairePortable`, les produits scalaires n'utilisent pas `fma`, qui serait mule (trs lente) sans l'instruction du processeur;
+    // `combinaison4Portable` l'utilise, pour donner le mme rsultat que `axpy`.
+
+    typedef void (*NoyauBloc)(const double *, const size_t, const double *, const size_t, const size_t, double *, const size_t);
+
+    template <size_t V>
+    void produitsScalairesBlocPortable(const double * _lignes, const size_t _pas, const double * _vecteurs, const size_t _pasVecteurs,
+                                       const size_t _taille, double * _resultats, const size_t _pasResultats){
+        double sommes[4][V];
+        #pragma GCC unroll 4
+        for (size_t r = 0; r < 4; r++){
+            #pragma GCC unroll 4
+            for (size_t v = 0; v < V; v++){
+                sommes[r][v] = 0;
+            }
+        }
+        for (size_t j = 0; j < _taille; j++){
+            double x[V];
+            #pragma GCC unroll 4
+            for (size_t v = 0; v < V; v++){
+                x[v] = _vecteurs[v * _pasVecteurs + j];
+            }
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                const double a = _lignes[r * _pas + j];
+                #pragma GCC unroll 4
+                for (size_t v = 0; v < V; v++){
+                    sommes[r][v] += a * x[v];
+                }
+            }
+        }
+        #pragma GCC unroll 4
+        for (size_t v = 0; v < V; v++){
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                _resultats[v * _pasResultats + r] = sommes[r][v];
+            }
+        }
+    }
+
+    void combinaison4Portable(double * _y, const double * _lignes, const size_t _pas, const double * _coefficients, const size_t _taille){
+        const double * l0 = _lignes;
+        const double * l1 = _lignes + _pas;
+        const double * l2 = _lignes + 2 * _pas;
+        const double * l3 = _lignes + 3 * _pas;
+        const double c0 = _coefficients[0], c1 = _coefficients[1], c2 = _coefficients[2], c3 = _coefficients[3];
+        for (size_t j = 0; j < _taille; j++){
+            _y[j] = fma(c3, l3[j], fma(c2, l2[j], fma(c1, l1[j], fma(c0, l0[j], _y[j]))));
+        }
+    }
+
+    /** \brief Remplace `_x` par sa mantisse (0.5 <= |mantisse| < 1) et ajoute son exposant en base 2  `_exposant`. Les nombres normaux sont
+     * dcomposs directement sur leurs bits; les autres (zro, sous-normaux, infinis, NaN) passent par `frexp`.
+     */
+    inline double decomposer(const double _x, int64_t & _exposant){
+        uint64_t bits;
+        memcpy(&bits, &_x, sizeof(bits));
+        const uint64_t champExposant = (bits >> 52) & 0x7FF;
+        if (champExposant == 0 || champExposant == 0x7FF){
+            int exposant;
+            const double mantisse = frexp(_x, &exposant);
+            _exposant += exposant;
+            return mantisse;
+        }
+        _exposant += int64_t(champExposant) - 1022;
+        bits = (bits & ~(uint64_t(0x7FF) << 52)) | (uint64_t(1022) << 52);
+        double mantisse;
+        memcpy(&mantisse, &bits, sizeof(mantisse));
+        return mantisse;
+    }
+
+    /** \brief Forme d'une puissance (voir Noyaux::puissance), dtermine une seule fois par appel.
+     */
+    struct FormePuissance
+    {
+        enum Type
+        {
+            UN,           // p = 0
+            IDENTITE,     // p = 1
+            ENTIERE,      // p = k
+            DEMI_ENTIERE, // p = (k + 0.5)
+            QUART,        // p = 0.25
+            GENERALE,     // exp(p * log(x)), vectoris
+            POW           // pow lment par lment
+        };
+
+        Type type;
+        unsigned int k;
+        bool inverse;
+        double puissance;
+    };
+
+    // Puissances spciales: seulement celles dont l'erreur reste sous 2 ulp (chaque multiplication ou inverse ajoute un arrondi; x^7 par
+    // multiplications atteint 4 ulp, plus que le noyau gnral). Au-del de PUISSANCE_GENERALE_MAXIMALE, l'erreur du noyau gnral (qui crot
+    // avec |p|) dpasserait 2 ulp.
+    const double PUISSANCE_ENTIERE_MINIMALE = -2;
+    const double PUISSANCE_ENTIERE_MAXIMALE = 4;
+    const double PUISSANCE_GENERALE_MAXIMALE = 32;
+
+    FormePuissance classerPuissance(const double _puissance){
+        FormePuissance retour;
+        retour.puissance = _puissance;
+        retour.k = 0;
+        retour.inverse = _puissance < 0;
+        const double absolue = fabs(_puissance);
+        if (_puissance == 0){
+            retour.type = FormePuissance::UN;
+        }
+        else if (_puissance == 1){
+            retour.type = FormePuissance::IDENTITE;
+        }
+        else if (_puissance >= PUISSANCE_ENTIERE_MINIMALE && _puissance <= PUISSANCE_ENTIERE_MAXIMALE && absolue == floor(absolue)){
+            retour.type = FormePuissance::ENTIERE;
+            retour.k = (unsigned int)absolue;
+        }
+        else if (_puissance == 0.5 || _puissance == -0.5 || _puissance == 1.5 || _puissance == 2.5){
+            retour.type = FormePuissance::DEMI_ENTIERE;
+            retour.k = (unsigned int)floor(absolue);
+        }
+        else if (absolue == 0.25){
+            retour.type = FormePuissance::QUART;
+        }
+        else if (absolue <= PUISSANCE_GENERALE_MAXIMALE){
+            retour.type = FormePuissance::GENERALE;
+        }
+        else {
+            retour.type = FormePuissance::POW; // Aussi pour p infini ou NaN.
+        }
+        return retour;
+    }
+
+    /** \brief x^k par exponentiation binaire: environ log2(k) + (nombre de bits  1 de k) - 1 multiplications.
+     */
+    inline double puissanceEntiere(double _x, unsigned int _k){
+        double retour = 1;
+        while (true){
+            if (_k & 1){
+                retour *= _x;
+            }
+            _k >>= 1;
+            if (_k == 0){
+                return retour;
+            }
+            _x *= _x;
+        }
+    }
+
+    /** \brief Vrai si `1 / x^k` (p = -k) garde la prcision annonce: x^k n'a ni dpass (infini, alors que x^-k serait un petit nombre non nul)
+     * ni perdu de chiffres dans les sous-normaux, et l'inverse n'est pas sous-normal. x^k nul donne un infini, comme pow. Sinon, on passe par pow.
+     */
+    inline bool inverseFiable(const double _puissanceK, const double _inverse){
+        return _puissanceK == 0 || (fabs(_puissanceK) >= DBL_MIN && fabs(_inverse) >= DBL_MIN);
+    }
+
+    /** \brief Version scalaire des puissances spciales (mmes oprations, dans le mme ordre, que la version AVX2).
+     */
+    double puissanceScalaire(const double _x, const FormePuissance & _forme){
+        switch (_forme.type){
+            case FormePuissance::UN:
+                return 1;
+            case FormePuissance::IDENTITE:
+                return _x;
+            case FormePuissance::ENTIERE: {
+                const double retour = puissanceEntiere(_x, _forme.k);
+                if (!_forme.inverse){
+                    return retour;
+                }
+                const double inverse = 1 / retour;
+                return inverseFiable(retour, inverse) ? inverse : pow(_x, _forme.puissance);
+            }
+            case FormePuissance::DEMI_ENTIERE:
+            case FormePuissance::QUART: {
+                if (_x == -INFINITY){
+                    return _forme.inverse ? 0 : INFINITY;
+                }
+                const double x = _x + 0.0; // -0 devient +0, comme pour pow.
+                const double racine = sqrt(x);
+                const double retour = _forme.type == FormePuissance::QUART ? sqrt(racine) : puissanceEntiere(x, _forme.k) * racine;
+                return _forme.inverse ? 1 / retour : retour;
+            }
+            default:
+                return pow(_x, _forme.puissance);
+        }
+    }
+
+    void puissancePortable(double * _destination, const double * _source, const double _puissance, const size_t _taille){
+        const FormePuissance forme = classerPuissance(_puissance);
+        for (size_t i = 0; i < _taille; i++){
+            _destination[i] = puissanceScalaire(_source[i], forme);
+        }
+    }
+
+#ifdef NOYAUX_X86
+
+    /* Chargement de 8 lments compacts convertis en deux registres de 4 doubles. */
+
+    __attribute__((target("avx2"))) inline void charger8(const float * _p, __m256d & _bas, __m256d & _haut){
+        _bas = _mm256_cvtps_pd(_mm_loadu_ps(_p));
+        _haut = _mm256_cvtps_pd(_mm_loadu_ps(_p + 4));
+    }
+
+    __attribute__((target("avx2"))) inline void charger8(const uint16_t * _p, __m256d & _bas, __m256d & _haut){
+        // Un bfloat16 est la moiti haute d'un float: on place ses 16 bits en haut d'un entier de 32 bits.
+        const __m256i entiers = _mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_p))), 16);
+        const __m256 flottants = _mm256_castsi256_ps(entiers);
+        _bas = _mm256_cvtps_pd(_mm256_castps256_ps128(flottants));
+        _haut = _mm256_cvtps_pd(_mm256_extractf128_ps(flottants, 1));
+    }
+
+    __attribute__((target("avx2"))) inline double additionnerVoies(const __m256d _registre){
+        double voies[4];
+        _mm256_storeu_pd(voies, _registre);
+        return (voies[0] + voies[1]) + (voies[2] + voies[3]);
+    }
+
+    template <typename T>
+    __attribute__((target("avx2"))) double produitScalaireCompactAVX2(const T * _a, const T * _b, const size_t _taille){
+        __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd(), s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 16 <= _taille; i += 16){
+            __m256d a0, a1, a2, a3, b0, b1, b2, b3;
+            charger8(_a + i, a0, a1);
+            charger8(_a + i + 8, a2, a3);
+            charger8(_b + i, b0, b1);
+            charger8(_b + i + 8, b2, b3);
+            s0 = _mm256_add_pd(s0, _mm256_mul_pd(a0, b0));
+            s1 = _mm256_add_pd(s1, _mm256_mul_pd(a1, b1));
+            s2 = _mm256_add_pd(s2, _mm256_mul_pd(a2, b2));
+            s3 = _mm256_add_pd(s3, _mm256_mul_pd(a3, b3));
+        }
+        double retour = additionnerVoies(_mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+        for (; i < _taille; i++){
+            retour += versDouble(_a[i]) * versDouble(_b[i]);
+        }
+        return retour;
+    }
+
+    template <typename T>
+    __attribute__((target("avx2"))) double sommeCompactAVX2(const T * _a, const size_t _taille){
+        __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd(), s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 16 <= _taille; i += 16){
+            __m256d a0, a1, a2, a3;
+            charger8(_a + i, a0, a1);
+            charger8(_a + i + 8, a2, a3);
+            s0 = _mm256_add_pd(s0, a0);
+            s1 = _mm256_add_pd(s1, a1);
+            s2 = _mm256_add_pd(s2, a2);
+            s3 = _mm256_add_pd(s3, a3);
+        }
+        double retour = additionnerVoies(_mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+        for (; i < _taille; i++){
+            retour += versDouble(_a[i]);
+        }
+        return retour;
+    }
+
+    __attribute__((target("avx2"))) inline int64_t additionnerVoiesEntieres(const __m256i _registre){
+        int32_t voies[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(voies), _registre);
+        int64_t retour = 0;
+        for (size_t j = 0; j < 8; j++){
+            retour += voies[j];
+        }
+        return retour;
+    }
+
+    // Une voie de `_mm256_madd_epi16` vaut au plus 2 * 128 * 128 = 2^15: on peut en additionner 2^15 dans un int32 sans dpassement.
+    const size_t ITERATIONS_PAR_BLOC_INT8 = size_t(1) << 15;
+
+    __attribute__((target("avx2"))) int64_t produitScalaireInt8AVX2(const int8_t * _a, const int8_t * _b, const size_t _taille){
+        int64_t retour = 0;
+        size_t i = 0;
+        while (i + 16 <= _taille){
+            const size_t finBloc = i + 16 * min(ITERATIONS_PAR_BLOC_INT8, (_taille - i) / 16);
+            __m256i accumulateur = _mm256_setzero_si256();
+            for (; i < finBloc; i += 16){
+                const __m256i a = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_a + i)));
+                const __m256i b = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_b + i)));
+                accumulateur = _mm256_add_epi32(accumulateur, _mm256_madd_epi16(a, b));
+            }
+            retour += additionnerVoiesEntieres(accumulateur);
+        }
+        return retour + produitScalaireInt8Portable(_a + i, _b + i, _taille - i);
+    }
+
+    __attribute__((target("avx2"))) int64_t sommeInt8AVX2(const int8_t * _a, const size_t _taille){
+        const __m256i uns = _mm256_set1_epi16(1);
+        int64_t retour = 0;
+        size_t i = 0;
+        while (i + 16 <= _taille){
+            const size_t finBloc = i + 16 * min(ITERATIONS_PAR_BLOC_INT8, (_taille - i) / 16);
+            __m256i accumulateur = _mm256_setzero_si256();
+            for (; i < finBloc; i += 16){
+                const __m256i a = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_a + i)));
+                accumulateur = _mm256_add_epi32(accumulateur, _mm256_madd_epi16(a, uns));
+            }
+            retour += additionnerVoiesEntieres(accumulateur);
+        }
+        return retour + sommeInt8Portable(_a + i, _taille - i);
+    }
+
+    /* Rductions compenses en AVX2 + FMA: 4 registres de sommes et 4 de corrections (16 voies), pour que la chane de dpendances de chaque
+     * voie (une addition par lment) ne limite pas le dbit. */
+
+    __attribute__((target("avx2,fma"))) inline void deuxSommesAVX2(__m256d & _somme, __m256d & _correction, const __m256d _x){
+        const __m256d total = _mm256_add_pd(_somme, _x);
+        const __m256d z = _mm256_sub_pd(total, _somme);
+        _correction = _mm256_add_pd(_correction, _mm256_add_pd(_mm256_sub_pd(_somme, _mm256_sub_pd(total, z)), _mm256_sub_pd(_x, z)));
+        _somme = total;
+    }
+
+    template <bool PRODUIT>
+    __attribute__((target("avx2,fma"))) double reductionCompenseeAVX2(const double * _a, const double * _b, const size_t _taille){
+        __m256d s[4], c[4];
+        for (size_t k = 0; k < 4; k++){
+            s[k] = _mm256_setzero_pd();
+            c[k] = _mm256_setzero_pd();
+        }
+        size_t i = 0;
+        for (; i + 16 <= _taille; i += 16){
+            for (size_t k = 0; k < 4; k++){
+                const __m256d a = _mm256_loadu_pd(_a + i + 4 * k);
+                if (PRODUIT){
+                    const __m256d b = _mm256_loadu_pd(_b + i + 4 * k);
+                    const __m256d terme = _mm256_mul_pd(a, b);
+                    deuxSommesAVX2(s[k], c[k], terme);
+                    c[k] = _mm256_add_pd(c[k], _mm256_fmsub_pd(a, b, terme));
+                }
+                else {
+                    deuxSommesAVX2(s[k], c[k], a);
+                }
+            }
+        }
+        double sommes[16], corrections[16];
+        for (size_t k = 0; k < 4; k++){
+            _mm256_storeu_pd(sommes + 4 * k, s[k]);
+            _mm256_storeu_pd(corrections + 4 * k, c[k]);
+        }
+        return combinerVoiesCompensees(sommes, corrections, 16, _a + i, PRODUIT ? _b + i : nullptr, _taille - i);
+    }
+
+    /* Niveau 1 de BLAS en AVX2 + FMA. Les fins de tableau passent par `fma`: le rsultat de chaque lment est le mme que la version portable.
+     * Les rductions utilisent plusieurs registres accumulateurs, comme les autres noyaux. */
+
+    __attribute__((target("avx2,fma"))) void axpyAVX2(double * _y, const double _a, const double * _x, const size_t _taille){
+        const __m256d a = _mm256_set1_pd(_a);
+        size_t i = 0;
+        for (; i + 8 <= _taille; i += 8){
+            _mm256_storeu_pd(_y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(_x + i), _mm256_loadu_pd(_y + i)));
+            _mm256_storeu_pd(_y + i + 4, _mm256_fmadd_pd(a, _mm256_loadu_pd(_x + i + 4), _mm256_loadu_pd(_y + i + 4)));
+        }
+        axpyPortable(_y + i, _a, _x + i, _taille - i);
+    }
+
+    __attribute__((target("avx2,fma"))) void axpbyAVX2(double * _y, const double _a, const double * _x, const double _b, const size_t _taille){
+        const __m256d a = _mm256_set1_pd(_a);
+        const __m256d b = _mm256_set1_pd(_b);
+        size_t i = 0;
+        for (; i + 8 <= _taille; i += 8){
+            _mm256_storeu_pd(_y + i, _mm256_fmadd_pd(a, _mm256_loadu_pd(_x + i), _mm256_mul_pd(b, _mm256_loadu_pd(_y + i))));
+            _mm256_storeu_pd(_y + i + 4, _mm256_fmadd_pd(a, _mm256_loadu_pd(_x + i + 4), _mm256_mul_pd(b, _mm256_loadu_pd(_y + i + 4))));
+        }
+        axpbyPortable(_y + i, _a, _x + i, _b, _taille - i);
+    }
+
+    __attribute__((target("avx2,fma"))) double produitScalaireEtSommesCarresAVX2(const double * _a, const double * _b, const size_t _taille,
+                                                                                double & _carresA, double & _carresB){
+        __m256d produits[2], carresA[2], carresB[2];
+        for (size_t k = 0; k < 2; k++){
+            produits[k] = _mm256_setzero_pd();
+            carresA[k] = _mm256_setzero_pd();
+            carresB[k] = _mm256_setzero_pd();
+        }
+        size_t i = 0;
+        for (; i + 8 <= _taille; i += 8){
+            for (size_t k = 0; k < 2; k++){
+                const __m256d a = _mm256_loadu_pd(_a + i + 4 * k);
+                const __m256d b = _mm256_loadu_pd(_b + i + 4 * k);
+                produits[k] = _mm256_fmadd_pd(a, b, produits[k]);
+                carresA[k] = _mm256_fmadd_pd(a, a, carresA[k]);
+                carresB[k] = _mm256_fmadd_pd(b, b, carresB[k]);
+            }
+        }
+        double carresFinA, carresFinB;
+        const double produitFin = produitScalaireEtSommesCarresPortable(_a + i, _b + i, _taille - i, carresFinA, carresFinB);
+        _carresA = additionnerVoies(_mm256_add_pd(carresA[0], carresA[1])) + carresFinA;
+        _carresB = additionnerVoies(_mm256_add_pd(carresB[0], carresB[1])) + carresFinB;
+        return additionnerVoies(_mm256_add_pd(produits[0], produits[1])) + produitFin;
+    }
+
+    __attribute__((target("avx2,fma"))) double distanceCarreeAVX2(const double * _a, const double * _b, const size_t _taille){
+        __m256d sommes[4];
+        for (size_t k = 0; k < 4; k++){
+            sommes[k] = _mm256_setzero_pd();
+        }
+        size_t i = 0;
+        for (; i + 16 <= _taille; i += 16){
+            for (size_t k = 0; k < 4; k++){
+                const __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(_a + i + 4 * k), _mm256_loadu_pd(_b + i + 4 * k));
+                sommes[k] = _mm256_fmadd_pd(difference, difference, sommes[k]);
+            }
+        }
+        const __m256d total = _mm256_add_pd(_mm256_add_pd(sommes[0], sommes[1]), _mm256_add_pd(sommes[2], sommes[3]));
+        return additionnerVoies(total) + distanceCarreePortable(_a + i, _b + i, _taille - i);
+    }
+
+    /* Niveau 2 de BLAS en AVX2 + FMA et en AVX-512. Bloc de 4 lignes x V vecteurs:  chaque pas, on charge 4 + V registres pour 4 * V FMA
+     * (4 x 2 en AVX2: 8 accumulateurs sur 16 registres; 4 x 4 en AVX-512: 16 accumulateurs sur 32 registres). Chaque paire (ligne, vecteur) a son
+     * propre accumulateur, additionn de la mme faon peu importe V: un vecteur seul (V = 1) donne le mme rsultat que dans un bloc. La fin de
+     * la ligne (moins d'un registre) est accumule  part avec `fma`, puis ajoute. Les boucles sur les lignes et les vecteurs du bloc sont
+     * droules (`#pragma GCC unroll`, aussi compris par Clang): sinon, avec -O2, les accumulateurs restent en mmoire plutt que dans les
+     * registres. */
+
+    template <size_t V>
+    __attribute__((target("avx2,fma"))) void produitsScalairesBlocAVX2(const double * _lignes, const size_t _pas, const double * _vecteurs,
+                                                                        const size_t _pasVecteurs, const size_t _taille, double * _resultats,
+                                                                        const size_t _pasResultats){
+        __m256d sommes[4][V];
+        #pragma GCC unroll 4
+        for (size_t r = 0; r < 4; r++){
+            #pragma GCC unroll 4
+            for (size_t v = 0; v < V; v++){
+                sommes[r][v] = _mm256_setzero_pd();
+            }
+        }
+        size_t j = 0;
+        for (; j + 4 <= _taille; j += 4){
+            __m256d x[V];
+            #pragma GCC unroll 4
+            for (size_t v = 0; v < V; v++){
+                x[v] = _mm256_loadu_pd(_vecteurs + v * _pasVecteurs + j);
+            }
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                const __m256d a = _mm256_loadu_pd(_lignes + r * _pas + j);
+                #pragma GCC unroll 4
+                for (size_t v = 0; v < V; v++){
+                    sommes[r][v] = _mm256_fmadd_pd(a, x[v], sommes[r][v]);
+                }
+            }
+        }
+        #pragma GCC unroll 4
+        for (size_t v = 0; v < V; v++){
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                double fin = 0;
+                for (size_t k = j; k < _taille; k++){
+                    fin = fma(_lignes[r * _pas + k], _vecteurs[v * _pasVecteurs + k], fin);
+                }
+                _resultats[v * _pasResultats + r] = additionnerVoies(sommes[r][v]) + fin;
+            }
+        }
+    }
+
+    __attribute__((target("avx512f"))) inline double additionnerVoies512(const __m512d _registre){
+        double voies[8];
+        _mm512_storeu_pd(voies, _registre);
+        return ((voies[0] + voies[1]) + (voies[2] + voies[3])) + ((voies[4] + voies[5]) + (voies[6] + voies[7]));
+    }
+
+    template <size_t V>
+    __attribute__((target("avx512f"))) void produitsScalairesBlocAVX512(const double * _lignes, const size_t _pas, const double * _vecteurs,
+                                                                         const size_t _pasVecteurs, const size_t _taille, double * _resultats,
+                                                                         const size_t _pasResultats){
+        __m512d sommes[4][V];
+        #pragma GCC unroll 4
+        for (size_t r = 0; r < 4; r++){
+            #pragma GCC unroll 4
+            for (size_t v = 0; v < V; v++){
+                sommes[r][v] = _mm512_setzero_pd();
+            }
+        }
+        size_t j = 0;
+        for (; j + 8 <= _taille; j += 8){
+            __m512d x[V];
+            #pragma GCC unroll 4
+            for (size_t v = 0; v < V; v++){
+                x[v] = _mm512_loadu_pd(_vecteurs + v * _pasVecteurs + j);
+            }
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                const __m512d a = _mm512_loadu_pd(_lignes + r * _pas + j);
+                #pragma GCC unroll 4
+                for (size_t v = 0; v < V; v++){
+                    sommes[r][v] = _mm512_fmadd_pd(a, x[v], sommes[r][v]);
+                }
+            }
+        }
+        #pragma GCC unroll 4
+        for (size_t v = 0; v < V; v++){
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                double fin = 0;
+                for (size_t k = j; k < _taille; k++){
+                    fin = fma(_lignes[r * _pas + k], _vecteurs[v * _pasVecteurs + k], fin);
+                }
+                _resultats[v * _pasResultats + r] = additionnerVoies512(sommes[r][v]) + fin;
+            }
+        }
+    }
+
+    __attribute__((target("avx2,fma"))) void combinaison4AVX2(double * _y, const double * _lignes, const size_t _pas, const double * _coefficients,
+                                                               const size_t _taille){
+        const double * lignes[4] = {_lignes, _lignes + _pas, _lignes + 2 * _pas, _lignes + 3 * _pas};
+        __m256d coefficients[4];
+        #pragma GCC unroll 4
+        for (size_t r = 0; r < 4; r++){
+            coefficients[r] = _mm256_set1_pd(_coefficients[r]);
+        }
+        size_t j = 0;
+        for (; j + 8 <= _taille; j += 8){
+            __m256d y0 = _mm256_loadu_pd(_y + j);
+            __m256d y1 = _mm256_loadu_pd(_y + j + 4);
+            #pragma GCC unroll 4
+            for (size_t r = 0; r < 4; r++){
+                y0 = _mm256_fmadd_pd(coefficients[r], _mm256_loadu_pd(lignes[r] + j), y0);
+                y1 = _mm256_fmadd_pd(coefficients[r], _mm256_loadu_pd(lignes[r] + j + 4), y1);
+            }
+            _mm256_storeu_pd(_y + j, y0);
+            _mm256_storeu_pd(_y + j + 4, y1);
+        }
+        combinaison4Portable(_y + j, _lignes + j, _pas, _coefficients, _taille - j);
+    }
+
+    /* Puissance en AVX2 + FMA (voir Noyaux::puissance). */
+
+    /** \brief x^K par exponentiation binaire (mmes multiplications, dans le mme ordre, que `puissanceEntiere`). K est connu  la compilation:
+     * la boucle disparat.
+     */
+    template <unsigned int K>
+    __attribute__((target("avx2,fma"))) inline __m256d puissanceEntiereAVX2(const __m256d _x){
+        const __m256d carre = _mm256_mul_pd(_x, _x);
+        switch (K){
+            case 0:
+                return _mm256_set1_pd(1.0);
+            case 1:
+                return _x;
+            case 2:
+                return carre;
+            case 3:
+                return _mm256_mul_pd(_x, carre);
+            default:
+                return _mm256_mul_pd(carre, carre);
+        }
+    }
+
+    /** \brief x^K ou x^-K sur [0, _fin). Pour x^-K, les voies dont l'inverse n'est pas fiable (voir `inverseFiable`) passent par pow.
+     */
+    template <unsigned int K>
+    __attribute__((target("avx2,fma"))) void boucleEntiereAVX2(double * _destination, const double * _source, const bool _inverse, const size_t _fin){
+        const __m256d masqueSigne = _mm256_set1_pd(-0.0);
+        const __m256d minimum = _mm256_set1_pd(DBL_MIN);
+        for (size_t i = 0; i < _fin; i += 4){
+            const __m256d retour = puissanceEntiereAVX2<K>(_mm256_loadu_pd(_source + i));
+            if (!_inverse){
+                _mm256_storeu_pd(_destination + i, retour);
+                continue;
+            }
+            const __m256d inverse = _mm256_div_pd(_mm256_set1_pd(1.0), retour);
+            const __m256d normaux = _mm256_and_pd(_mm256_cmp_pd(_mm256_andnot_pd(masqueSigne, retour), minimum, _CMP_GE_OQ),
+                                                  _mm256_cmp_pd(_mm256_andnot_pd(masqueSigne, inverse), minimum, _CMP_GE_OQ));
+            const int fiables = _mm256_movemask_pd(_mm256_or_pd(normaux, _mm256_cmp_pd(retour, _mm256_setzero_pd(), _CMP_EQ_OQ)));
+            if (fiables == 0xF){
+                _mm256_storeu_pd(_destination + i, inverse);
+                continue;
+            }
+            double valeurs[4]; // `_destination` peut tre `_source`: on lit la source avant d'crire.
+            _mm256_storeu_pd(valeurs, inverse);
+            for (size_t j = 0; j < 4; j++){
+                if (!(fiables & (1 << j))){
+                    valeurs[j] = pow(_source[i + j], -double(K));
+                }
+            }
+            memcpy(_destination + i, valeurs, sizeof(valeurs));
+        }
+    }
+
+    /** \brief a + b = _somme + _erreur exactement (TwoSum).
+     */
+    __attribute__((target("avx2,fma"))) inline void additionExacteAVX2(__m256d & _somme, __m256d & _erreur, const __m256d _a, const __m256d _b){
+        _somme = _mm256_add_pd(_a, _b);
+        const __m256d z = _mm256_sub_pd(_somme, _a);
+        _erreur = _mm256_add_pd(_mm256_sub_pd(_a, _mm256_sub_pd(_somme, z)), _mm256_sub_pd(_b, z));
+    }
+
+    /** \brief x^p = exp(p * log(x)) pour x normal et positif, avec log(x) et p * log(x) en double-double (une paire haut + bas): l'arrondi de
+     * log(x) serait sinon multipli par |p * log(x)| dans le rsultat. Les voies qui sortent du domaine (x <= 0, sous-normal, infini ou NaN,
+     * |p * log(x)| > 708, donc rsultat sous-normal ou infini) sont signales dans `_voiesInvalides`, pour tre recalcules avec pow.
+     * - log: x = 2^e * m, avec m dans [sqrt(2)/2, sqrt(2)), f = m - 1 (exact), et log(1 + f) = f - f^2/2 + s * (f^2/2 + R(s)), s = f / (2 + f),
+     *   avec le polynme R de fdlibm (erreur < 2^-58). f^2/2 est calcul exactement avec une FMA.
+     * - exp: z = k * log(2) + r, |r| <= log(2)/2, exp(r) par son dveloppement de Taylor jusqu'au degr 13 (erreur < 2^-57), puis 2^k ajout
+     *   directement  l'exposant du rsultat.
+     */
+    __attribute__((target("avx2,fma"))) inline __m256d puissanceGeneraleAVX2(const __m256d _x, const double _puissance, int & _voiesInvalides){
+        const __m256d un = _mm256_set1_pd(1.0);
+        const __m256d ln2Haut = _mm256_set1_pd(6.93147180369123816490e-01); // 32 derniers bits nuls: e * ln2Haut et k * ln2Haut sont exacts.
+        const __m256d ln2Bas = _mm256_set1_pd(1.90821492927058770002e-10);
+        const __m256d p = _mm256_set1_pd(_puissance);
+
+        // x = 2^e * m. AVX2 n'a pas de conversion int64 -> double: e + 2048 (12 bits) est plac dans la mantisse de 2^52.
+        const __m256i bits = _mm256_castpd_si256(_x);
+        const __m256i t = _mm256_sub_epi64(bits, _mm256_set1_epi64x(0x3fe6a09e667f3bcdLL));
+        const __m256d m = _mm256_castsi256_pd(_mm256_sub_epi64(bits, _mm256_and_si256(t, _mm256_set1_epi64x(int64_t(0xfffULL << 52)))));
+        const __m256i eDecale = _mm256_srli_epi64(_mm256_add_epi64(t, _mm256_set1_epi64x(int64_t(0x800ULL << 52))), 52);
+        const __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(eDecale, _mm256_set1_epi64x(0x4330000000000000LL))),
+                                        _mm256_set1_pd(4503599627370496.0 + 2048));
+
+        // log(1 + f)
+        const __m256d f = _mm256_sub_pd(m, un);
+        const __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+        const __m256d s2 = _mm256_mul_pd(s, s);
+        const __m256d s4 = _mm256_mul_pd(s2, s2);
+        __m256d impairs = _mm256_fmadd_pd(s4, _mm256_set1_pd(1.479819860511658591e-01), _mm256_set1_pd(1.818357216161805012e-01));
+        impairs = _mm256_fmadd_pd(s4, impairs, _mm256_set1_pd(2.857142874366239149e-01));
+        impairs = _mm256_fmadd_pd(s4, impairs, _mm256_set1_pd(6.666666666666735130e-01));
+        __m256d pairs = _mm256_fmadd_pd(s4, _mm256_set1_pd(1.531383769920937332e-01), _mm256_set1_pd(2.222219843214978396e-01));
+        pairs = _mm256_fmadd_pd(s4, pairs, _mm256_set1_pd(3.999999999940941908e-01));
+        const __m256d r = _mm256_fmadd_pd(s2, impairs, _mm256_mul_pd(s4, pairs));
+        const __m256d demiF = _mm256_mul_pd(_mm256_set1_pd(0.5), f);
+        const __m256d demiCarre = _mm256_mul_pd(demiF, f);
+        const __m256d demiCarreErreur = _mm256_fmsub_pd(demiF, f, demiCarre);
+        __m256d correctionHaut, correctionBas;
+        additionExacteAVX2(correctionHaut, correctionBas, _mm256_sub_pd(_mm256_setzero_pd(), demiCarre), _mm256_mul_pd(s, _mm256_add_pd(demiCarre, r)));
+        correctionBas = _mm256_sub_pd(correctionBas, demiCarreErreur);
+
+        // log(x) = e * ln2Haut + f + correction + e * ln2Bas, en double-double (logHaut, logBas).
+        __m256d somme1, erreur1, logHaut, erreur2;
+        additionExacteAVX2(somme1, erreur1, _mm256_mul_pd(e, ln2Haut), f);
+        additionExacteAVX2(logHaut, erreur2, somme1, correctionHaut);
+        const __m256d logBas = _mm256_fmadd_pd(e, ln2Bas, _mm256_add_pd(_mm256_add_pd(erreur1, erreur2), correctionBas));
+
+        // z = p * log(x), en double-double.
+        const __m256d zHaut = _mm256_mul_pd(p, logHaut);
+        const __m256d zBas = _mm256_fmadd_pd(p, logBas, _mm256_fmsub_pd(p, logHaut, zHaut));
+
+        // exp(z) = 2^k * exp(r), r = z - k * log(2)
+        const __m256d k = _mm256_round_pd(_mm256_mul_pd(zHaut, _mm256_set1_pd(1.44269504088896338700e+00)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        const __m256d rHaut = _mm256_fnmadd_pd(k, ln2Haut, zHaut);
+        const __m256d rBas = _mm256_fnmadd_pd(k, ln2Bas, zBas);
+        // Taylor: exp(r) - 1 = r + r^2 * (1/2! + r/3! + ... + r^11/13!). Le polynme est valu par le schma d'Estrin (par paires, puis
+        // avec r^2, r^4, r^8) plutt que de Horner: la chane de dpendances passe de 11 FMA  4.
+        const __m256d r2 = _mm256_mul_pd(rHaut, rHaut);
+        const __m256d r4 = _mm256_mul_pd(r2, r2);
+        const __m256d r8 = _mm256_mul_pd(r4, r4);
+        const __m256d t01 = _mm256_fmadd_pd(_mm256_set1_pd(1.0 / 6.0), rHaut, _mm256_set1_pd(0.5));
+        const __m256d t23 = _mm256_fmadd_pd(_mm256_set1_pd(1.0 / 120.0), rHaut, _mm256_set1_pd(1.0 / 24.0));
+        const __m256d t45 = _mm256_fmadd_pd(_mm256_set1_pd(1.0 / 5040.0), rHaut, _mm256_set1_pd(1.0 / 720.0));
+        const __m256d t67 = _mm256_fmadd_pd(_mm256_set1_pd(1.0 / 362880.0), rHaut, _mm256_set1_pd(1.0 / 40320.0));
+        const __m256d t89 = _mm256_fmadd_pd(_mm256_set1_pd(1.0 / 39916800.0), rHaut, _mm256_set1_pd(1.0 / 3628800.0));
+        const __m256d t1011 = _mm256_fmadd_pd(_mm256_set1_pd(1.0 / 6227020800.0), rHaut, _mm256_set1_pd(1.0 / 479001600.0));
+        const __m256d t03 = _mm256_fmadd_pd(t23, r2, t01);
+        const __m256d t47 = _mm256_fmadd_pd(t67, r2, t45);
+        const __m256d t811 = _mm256_fmadd_pd(t1011, r2, t89);
+        const __m256d taylor = _mm256_fmadd_pd(t811, r8, _mm256_fmadd_pd(t47, r4, t03));
+        __m256d q = _mm256_fmadd_pd(r2, taylor, rHaut);                         // exp(rHaut) - 1
+        q = _mm256_add_pd(q, _mm256_fmadd_pd(q, rBas, rBas));                     // exp(rHaut + rBas) - 1
+        const __m256d v = _mm256_add_pd(un, q);
+        const __m256i decalageK = _mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(k, _mm256_set1_pd(6755399441055744.0))), 52);
+        const __m256d retour = _mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(v), decalageK));
+
+        const __m256d valides = _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(_x, _mm256_set1_pd(2.2250738585072014e-308), _CMP_GE_OQ),
+                                                            _mm256_cmp_pd(_x, _mm256_set1_pd(INFINITY), _CMP_LT_OQ)),
+                                              _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), zHaut), _mm256_set1_pd(708.0), _CMP_LE_OQ));
+        _voiesInvalides = (~_mm256_movemask_pd(valides)) & 0xF;
+        return retour;
+    }
+
+    /** \brief Racine carre (p = 0.5, 1.5, 2.5) ou quatrime (p = 0.25) de 4 lments, avec les cas limites de pow (voir Noyaux::puissance).
+     */
+    __attribute__((target("avx2,fma"))) inline __m256d puissanceRacineAVX2(const __m256d _x, const FormePuissance & _forme){
+        const __m256d positif = _mm256_add_pd(_x, _mm256_setzero_pd()); // -0 devient +0, comme pour pow.
+        const __m256d racine = _mm256_sqrt_pd(positif);
+        __m256d retour;
+        if (_forme.type == FormePuissance::QUART){
+            retour = _mm256_sqrt_pd(racine);
+        }
+        else {
+            retour = _forme.k == 0 ? racine : _mm256_mul_pd(_forme.k == 1 ? positif : puissanceEntiereAVX2<2>(positif), racine);
+        }
+        if (_forme.inverse){
+            retour = _mm256_div_pd(_mm256_set1_pd(1.0), retour);
+        }
+        const __m256d moinsInfini = _mm256_cmp_pd(_x, _mm256_set1_pd(-INFINITY), _CMP_EQ_OQ);
+        return _mm256_blendv_pd(retour, _mm256_set1_pd(_forme.inverse ? 0.0 : INFINITY), moinsInfini);
+    }
+
+    /** \brief Applique la puissance aux lments [0, _taille - _taille % 4). Chaque forme a sa propre boucle, pour que le corps soit
+     * entirement droul dans la boucle (et que le processeur puisse chevaucher les itrations).
+     */
+    __attribute__((target("avx2,fma"))) void puissancePaquetsAVX2(double * _destination, const double * _source, const FormePuissance & _forme,
+                                                                  const size_t _taille){
+        const size_t fin = _taille - _taille % 4;
+        switch (_forme.type){
+            case FormePuissance::ENTIERE:
+                switch (_forme.k){
+                    case 1:
+                        boucleEntiereAVX2<1>(_destination, _source, _forme.inverse, fin);
+                        break;
+                    case 2:
+                        boucleEntiereAVX2<2>(_destination, _source, _forme.inverse, fin);
+                        break;
+                    case 3:
+                        boucleEntiereAVX2<3>(_destination, _source, _forme.inverse, fin);
+                        break;
+                    default:
+                        boucleEntiereAVX2<4>(_destination, _source, _forme.inverse, fin);
+                        break;
+                }
+                break;
+            case FormePuissance::DEMI_ENTIERE:
+            case FormePuissance::QUART:
+                for (size_t i = 0; i < fin; i += 4){
+                    _mm256_storeu_pd(_destination + i, puissanceRacineAVX2(_mm256_loadu_pd(_source + i), _forme));
+                }
+                break;
+            case FormePuissance::GENERALE:
+                for (size_t i = 0; i < fin; i += 4){
+                    int voiesInvalides;
+                    const __m256d retour = puissanceGeneraleAVX2(_mm256_loadu_pd(_source + i), _forme.puissance, voiesInvalides);
+                    if (voiesInvalides == 0){
+                        _mm256_storeu_pd(_destination + i, retour);
+                        continue;
+                    }
+                    double valeurs[4];
+                    _mm256_storeu_pd(valeurs, retour);
+                    for (size_t j = 0; j < 4; j++){
+                        if (voiesInvalides & (1 << j)){
+                            valeurs[j] = pow(_source[i + j], _forme.puissance);
+                        }
+                    }
+                    memcpy(_destination + i, valeurs, sizeof(valeurs));
+                }
+                break;
+            default:
+                for (size_t i = 0; i < fin; i++){
+                    _destination[i] = puissanceScalaire(_source[i], _forme);
+                }
+                break;
+        }
+    }
+
+    void puissanceAVX2(double * _destination, const double * _source, const double _puissance, const size_t _taille){
+        const FormePuissance forme = classerPuissance(_puissance);
+        puissancePaquetsAVX2(_destination, _source, forme, _taille);
+        const size_t reste = _taille % 4;
+        if (reste > 0){
+            // Fin du tableau: on complte un paquet de 4 avec des 1, pour calculer exactement comme les autres lments.
+            double tampon[4] = {1, 1, 1, 1};
+            memcpy(tampon, _source + _taille - reste, reste * sizeof(double));
+            puissancePaquetsAVX2(tampon, tampon, forme, 4);
+            memcpy(_destination + _taille - reste, tampon, reste * sizeof(double));
+        }
+    }
+
+    /** \brief Intervalle (voir Noyaux::remplirIntervalle), 4 lments  la fois. La conversion index -> double n'existe pas en AVX2 pour des
+     * entiers de 64 bits: on place l'index dans la mantisse de 2^52 (bits de 2^52 OU index), puis on soustrait 2^52. C'est exact pour tout index
+     * infrieur  2^52. Pas de FMA: le rsultat doit tre `debut + double(i) * pas` avec deux arrondis, comme la version portable.
+     */
+    __attribute__((target("avx2"))) void remplirIntervalleAVX2(double * _destination, const double _debut, const double _pas,
+                                                               const size_t _premierIndex, const size_t _taille){
+        const __m256i bitsDeuxPuissance52 = _mm256_set1_epi64x(0x4330000000000000LL);
+        const __m256d deuxPuissance52 = _mm256_set1_pd(4503599627370496.0);
+        const __m256d debut = _mm256_set1_pd(_debut);
+        const __m256d pas = _mm256_set1_pd(_pas);
+        const __m256i quatre = _mm256_set1_epi64x(4);
+        __m256i index = _mm256_add_epi64(_mm256_set1_epi64x((long long)_premierIndex), _mm256_setr_epi64x(0, 1, 2, 3));
+        size_t i = 0;
+        for (; i + 4 <= _taille; i += 4){
+            const __m256d indexDouble = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(index, bitsDeuxPuissance52)), deuxPuissance52);
+            _mm256_storeu_pd(_destination + i, _mm256_add_pd(debut, _mm256_mul_pd(indexDouble, pas)));
+            index = _mm256_add_epi64(index, quatre);
+        }
+        for (; i < _taille; i++){
+            _destination[i] = _debut + double(_premierIndex + i) * _pas;
+        }
+    }
+
+#endif // NOYAUX_X86
+
+    const TableNoyaux * tablePour(const Noyaux::JeuInstructions _jeu){
+#ifdef NOYAUX_X86
+        switch (_jeu){
+            case Noyaux::AVX512:
+                return &tableAVX512;
+            case Noyaux::AVX2:
+                return &tableAVX2;
+            case Noyaux::SSE2:
+                return &tableSSE2;
+            default:
+                break;
+        }
+#endif
+        (void)_jeu;
+        return &tablePortable;
+    }
+
+    atomic<const TableNoyaux *> tableCourante(nullptr);
+
+    /** \brief Retourne la table courante. Au premier appel, on choisit le meilleur jeu d'instructions support.
+     */
+    const TableNoyaux & table(){
+        const TableNoyaux * courante = tableCourante.load(memory_order_acquire);
+        if (courante == nullptr){
+            courante = tablePour(Noyaux::jeuInstructionsDetecte());
+            tableCourante.store(courante, memory_order_release);
+        }
+        return *courante;
+    }
+
+#ifdef NOYAUX_X86
+    /** \brief Vrai si les noyaux compacts AVX2 doivent tre utiliss (jeu d'instructions courant AVX2 ou mieux).
+     */
+    bool noyauxCompactsAVX2(){
+        return table().jeu >= Noyaux::AVX2;
+    }
+
+    /** \brief Vrai si les noyaux AVX2 + FMA (rductions compenses, puissance) doivent tre utiliss. La FMA est dtecte  part: quelques
+     * processeurs AVX2 ne l'ont pas.
+     */
+    bool noyauxAVX2FMA(){
+        static const bool fmaDisponible = __builtin_cpu_supports("fma");
+        return fmaDisponible && noyauxCompactsAVX2();
+    }
+#endif
+
+    // Sommation par paires (voir Noyaux::PAR_PAIRES): on coupe sur une frontire de bloc, pour que chaque feuille (sauf la dernire) ait
+    // exactement TAILLE_BLOC_PAR_PAIRES lments.
+    const size_t TAILLE_BLOC_PAR_PAIRES = 256;
+
+    size_t moitieParPaires(const size_t _taille){
+        const size_t blocs = (_taille + TAILLE_BLOC_PAR_PAIRES - 1) / TAILLE_BLOC_PAR_PAIRES;
+        return (blocs / 2) * TAILLE_BLOC_PAR_PAIRES;
+    }
+
+    double sommeParPaires(const double * _a, const size_t _taille){
+        if (_taille <= TAILLE_BLOC_PAR_PAIRES){
+            return table().somme(_a, _taille);
+        }
+        const size_t moitie = moitieParPaires(_taille);
+        return sommeParPaires(_a, moitie) + sommeParPaires(_a + moitie, _taille - moitie);
+    }
+
+    double produitScalaireParPaires(const double * _a, const double * _b, const size_t _taille){
+        if (_taille <= TAILLE_BLOC_PAR_PAIRES){
+            return table().produitScalaire(_a, _b, _taille);
+        }
+        const size_t moitie = moitieParPaires(_taille);
+        return produitScalaireParPaires(_a, _b, moitie) + produitScalaireParPaires(_a + moitie, _b + moitie, _taille - moitie);
+    }
+}
+
+Noyaux::JeuInstructions Noyaux::jeuInstructionsDetecte(){
+#ifdef NOYAUX_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")){
+        return AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")){
+        return AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")){
+        return SSE2;
+    }
+#endif
+    return SCALAIRE;
+}
+
+Noyaux::JeuInstructions Noyaux::jeuInstructions(){
+    return table().jeu;
+}
+
+const char * Noyaux::nomJeuInstructions(const JeuInstructions _jeu){
+    switch (_jeu){
+        case AVX512:
+            return "avx512";
+        case AVX2:
+            return "avx2";
+        case SSE2:
+            return "sse2";
+        default:
+            return "scalaire";
+    }
+}
+
+Noyaux::JeuInstructions Noyaux::choisirJeuInstructions(const JeuInstructions _jeu){
+    const JeuInstructions detecte = jeuInstructionsDetecte();
+    const JeuInstructions retour = _jeu < detecte ? _jeu : detecte;
+    tableCourante.store(tablePour(retour), memory_order_release);
+    return retour;
+}
+
+double Noyaux::produitScalaire(const double * _a, const double * _b, const size_t _taille){
+    return table().produitScalaire(_a, _b, _taille);
+}
+
+double Noyaux::somme(const double * _a, const size_t _taille){
+    return table().somme(_a, _taille);
+}
+
+double Noyaux::produit(const double * _a, const size_t _taille){
+    return table().produit(_a, _taille);
+}
+
+double Noyaux::sommeCarres(const double * _a, const size_t _taille){
+    return table().sommeCarres(_a, _taille);
+}
+
+void Noyaux::ajouter(double * _destination, const double * _source, const size_t _taille){
+    table().ajouter(_destination, _source, _taille);
+}
+
+void Noyaux::soustraire(double * _destination, const double * _source, const size_t _taille){
+    table().soustraire(_destination, _source, _taille);
+}
+
+void Noyaux::ajouterScalaire(double * _destination, const double _scalaire, const size_t _taille){
+    table().ajouterScalaire(_destination, _scalaire, _taille);
+}
+
+void Noyaux::multiplierScalaire(double * _destination, const double _scalaire, const size_t _taille){
+    table().multiplierScalaire(_destination, _scalaire, _taille);
+}
+
+void Noyaux::diviserScalaire(double * _destination, const double _scalaire, const size_t _taille){
+    table().diviserScalaire(_destination, _scalaire, _taille);
+}
+
+double Noyaux::produitScalaire(const double * _a, const double * _b, const size_t _taille, const Reduction _reduction){
+    switch (_reduction){
+        case PAR_PAIRES:
+            return produitScalaireParPaires(_a, _b, _taille);
+        case COMPENSEE:
+#ifdef NOYAUX_X86
+            if (noyauxAVX2FMA()){
+                return reductionCompenseeAVX2<true>(_a, _b, _taille);
+            }
+#endif
+            return produitScalaireCompensePortable(_a, _b, _taille);
+        default:
+            return produitScalaire(_a, _b, _taille);
+    }
+}
+
+double Noyaux::somme(const double * _a, const size_t _taille, const Reduction _reduction){
+    switch (_reduction){
+        case PAR_PAIRES:
+            return sommeParPaires(_a, _taille);
+        case COMPENSEE:
+#ifdef NOYAUX_X86
+            if (noyauxAVX2FMA()){
+                return reductionCompenseeAVX2<false>(_a, nullptr, _taille);
+            }
+#endif
+            return sommeCompenseePortable(_a, _taille);
+        default:
+            return somme(_a, _taille);
+    }
+}
+
+double Noyaux::sommeCarres(const double * _a, const size_t _taille, const Reduction _reduction){
+    return produitScalaire(_a, _a, _taille, _reduction);
+}
+
+void Noyaux::axpy(double * _y, const double _a, const double * _x, const size_t _taille){
+#ifdef NOYAUX_X86
+    if (noyauxAVX2FMA()){
+        axpyAVX2(_y, _a, _x, _taille);
+        return;
+    }
+#endif
+    axpyPortable(_y, _a, _x, _taille);
+}
+
+void Noyaux::axpby(double * _y, const double _a, const double * _x, const double _b, const size_t _taille){
+#ifdef NOYAUX_X86
+    if (noyauxAVX2FMA()){
+        axpbyAVX2(_y, _a, _x, _b, _taille);
+        return;
+    }
+#endif
+    axpbyPortable(_y, _a, _x, _b, _taille);
+}
+
+double Noyaux::produitScalaireEtSommesCarres(const double * _a, const double * _b, const size_t _taille, double & _carresA, double & _carresB){
+#ifdef NOYAUX_X86
+    if (noyauxAVX2FMA()){
+        return produitScalaireEtSommesCarresAVX2(_a, _b, _taille, _carresA, _carresB);
+    }
+#endif
+    return produitScalaireEtSommesCarresPortable(_a, _b, _taille, _carresA, _carresB);
+}
+
+double Noyaux::distanceCarree(const double * _a, const double * _b, const size_t _taille){
+#ifdef NOYAUX_X86
+    if (noyauxAVX2FMA()){
+        return distanceCarreeAVX2(_a, _b, _taille);
+    }
+#endif
+    return distanceCarreePortable(_a, _b, _taille);
+}
+
+void Noyaux::produitsScalairesLignes(const double * _lignes, const size_t _pas, const size_t _nombreLignes, const double * _vecteurs,
+                                     const size_t _pasVecteurs, const size_t _nombreVecteurs, const size_t _taille, double * _resultats,
+                                     const size_t _pasResultats){
+    NoyauBloc bloc = produitsScalairesBlocPortable<2>;
+    NoyauBloc seul = produitsScalairesBlocPortable<1>;
+    size_t largeur = 2;
+#ifdef NOYAUX_X86
+    if (table().jeu >= AVX512){
+        bloc = produitsScalairesBlocAVX512<4>;
+        seul = produitsScalairesBlocAVX512<1>;
+        largeur = 4;
+    }
+    else if (noyauxAVX2FMA()){
+        bloc = produitsScalairesBlocAVX2<2>;
+        seul = produitsScalairesBlocAVX2<1>;
+    }
+#endif
+    size_t i = 0;
+    for (; i + 4 <= _nombreLignes; i += 4){
+        const double * lignes = _lignes + i * _pas;
+        size_t v = 0;
+        for (; v + largeur <= _nombreVecteurs; v += largeur){
+            bloc(lignes, _pas, _vecteurs + v * _pasVecteurs, _pasVecteurs, _taille, _resultats + v * _pasResultats + i, _pasResultats);
+        }
+        for (; v < _nombreVecteurs; v++){
+            seul(lignes, _pas, _vecteurs + v * _pasVecteurs, _pasVecteurs, _taille, _resultats + v * _pasResultats + i, _pasResultats);
+        }
+    }
+    for (; i < _nombreLignes; i++){
+        for (size_t v = 0; v < _nombreVecteurs; v++){
+            _resultats[v * _pasResultats + i] = table().produitScalaire(_lignes + i * _pas, _vecteurs + v * _pasVecteurs, _taille);
+        }
+    }
+}
+
+void Noyaux::combinaisonLignes(double * _y, const double * _lignes, const size_t _pas, const size_t _nombreLignes, const double * _coefficients,
+                               const size_t _taille){
+    size_t i = 0;
+#ifdef NOYAUX_X86
+    if (noyauxAVX2FMA()){
+        for (; i + 4 <= _nombreLignes; i += 4){
+            combinaison4AVX2(_y, _lignes + i * _pas, _pas, _coefficients + i, _taille);
+        }
+    }
+#endif
+    for (; i + 4 <= _nombreLignes; i += 4){
+        combinaison4Portable(_y, _lignes + i * _pas, _pas, _coefficients + i, _taille);
+    }
+    for (; i < _nombreLignes; i++){
+        axpy(_y, _coefficients[i], _lignes + i * _pas, _taille);
+    }
+}
+
+void Noyaux::puissance(double * _destination, const double * _source, const double _puissance, const size_t _taille){
+#ifdef NOYAUX_X86
+    if (noyauxAVX2FMA()){
+        puissanceAVX2(_destination, _source, _puissance, _taille);
+        return;
+    }
+#endif
+    puissancePortable(_destination, _source, _puissance, _taille);
+}
+
+void Noyaux::remplirIntervalle(double * _destination, const double _debut, const double _pas, const size_t _premierIndex, const size_t _taille){
+#ifdef NOYAUX_X86
+    if (noyauxCompactsAVX2() && _premierIndex + _taille <= (size_t(1) << 52)){
+        remplirIntervalleAVX2(_destination, _debut, _pas, _premierIndex, _taille);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < _taille; i++){
+        _destination[i] = _debut + double(_premierIndex + i) * _pas;
+    }
+}
+
+double Noyaux::produitEchelonne(const double * _a, const size_t _taille, int64_t & _exposant){
+    // 4 produits de mantisses indpendants (comme `produitPortable`). Les mantisses valent au moins 0.5: le produit de 512 mantisses vaut au
+    // moins 2^-512, loin du plus petit double normal (2^-1022). On renormalise donc chaque voie tous les 4 * 512 lments.
+    const size_t ELEMENTS_PAR_NORMALISATION = 4 * 512;
+    double mantisses[4] = {1, 1, 1, 1};
+    int64_t exposants[4] = {0, 0, 0, 0};
+    size_t i = 0;
+    for (; i + 4 <= _taille; ){
+        const size_t fin = i + min(ELEMENTS_PAR_NORMALISATION, (_taille - i) / 4 * 4);
+        for (; i < fin; i += 4){
+            for (size_t j = 0; j < 4; j++){
+                mantisses[j] *= decomposer(_a[i + j], exposants[j]);
+            }
+        }
+        for (size_t j = 0; j < 4; j++){
+            mantisses[j] = decomposer(mantisses[j], exposants[j]);
+        }
+    }
+    int64_t exposant = (exposants[0] + exposants[1]) + (exposants[2] + exposants[3]);
+    double mantisse = decomposer(mantisses[0] * mantisses[1], exposant) * decomposer(mantisses[2] * mantisses[3], exposant);
+    for (; i < _taille; i++){
+        mantisse *= decomposer(_a[i], exposant);
+    }
+    mantisse = decomposer(mantisse, exposant);
+    _exposant = exposant;
+    return mantisse;
+}
+
+#ifdef NOYAUX_X86
+#define APPELER_NOYAU_COMPACT(AVX2, PORTABLE) (noyauxCompactsAVX2() ? AVX2 : PORTABLE)
+#else
+#define APPELER_NOYAU_COMPACT(AVX2, PORTABLE) (PORTABLE)
+#endif
+
+double Noyaux::produitScalaire(const float * _a, const float * _b, const size_t _taille){
+    return APPELER_NOYAU_COMPACT(produitScalaireCompactAVX2(_a, _b, _taille), produitScalaireCompactPortable(_a, _b, _taille));
+}
+
+double Noyaux::somme(const float * _a, const size_t _taille){
+    return APPELER_NOYAU_COMPACT(sommeCompactAVX2(_a, _taille), sommeCompactPortable(_a, _taille));
+}
+
+double Noyaux::sommeCarres(const float * _a, const size_t _taille){
+    return produitScalaire(_a, _a, _taille);
+}
+
+double Noyaux::produitScalaireBfloat16(const uint16_t * _a, const uint16_t * _b, const size_t _taille){
+    return APPELER_NOYAU_COMPACT(produitScalaireCompactAVX2(_a, _b, _taille), produitScalaireCompactPortable(_a, _b, _taille));
+}
+
+double Noyaux::sommeBfloat16(const uint16_t * _a, const size_t _taille){
+    return APPELER_NOYAU_COMPACT(sommeCompactAVX2(_a, _taille), sommeCompactPortable(_a, _taille));
+}
+
+double Noyaux::sommeCarresBfloat16(const uint16_t * _a, const size_t _taille){
+    return produitScalaireBfloat16(_a, _a, _taille);
+}
+
+int64_t Noyaux::produitScalaire(const int8_t * _a, const int8_t * _b, const size_t _taille){
+    return APPELER_NOYAU_COMPACT(produitScalaireInt8AVX2(_a, _b, _taille), produitScalaireInt8Portable(_a, _b, _taille));
+}
+
+int64_t Noyaux::somme(const int8_t * _a, const size_t _taille){
+    return APPELER_NOYAU_COMPACT(sommeInt8AVX2(_a, _taille), sommeInt8Portable(_a, _taille));
+}
+
+int64_t Noyaux::sommeCarres(const int8_t * _a, const size_t _taille){
+    return produitScalaire(_a, _a, _taille);
+}
+
+#undef APPELER_NOYAU_COMPACT
@@ -0,0 +1,89 @@
+#include "PolitiqueExecution.h"
+#include "ReservoirTaches.h"
+
+#include <vector>
+
+const size_t PolitiqueExecution::SEUIL_PAR_DEFAUT;
+const size_t PolitiqueExecution::TAILLE_MORCEAU_DETERMINISTE;
+
+/** \brief Politique squentielle: tout s'excute sur le fil courant (comportement par dfaut de Vecteur).
+ */
+PolitiqueExecution PolitiqueExecution::sequentielle(){
+    PolitiqueExecution retour;
+    retour.mode = SEQUENTIELLE;
+    retour.seuil = 0;
+    retour.deterministe = true;
+    return retour;
+}
+
+/** \brief Politique parallle.
+ * \param _seuil: dimension minimale  partir de laquelle on paralllise. En dessous, le cot de coordination des fils dpasse le gain.
+ * \param _deterministe: si vrai, les rductions donnent le mme rsultat peu importe le nombre de fils (voir PolitiqueExecution.h).
+ * \return La politique.
+ */
+PolitiqueExecution PolitiqueExecution::parallele(const size_t _seuil, const bool _deterministe){
+    PolitiqueExecution retour;
+    retour.mode = PARALLELE;
+    retour.seuil = _seuil;
+    retour.deterministe = _deterministe;
+    return retour;
+}
+
+/** \brief Indique si une opration sur un Vecteur de dimension `_dimension` doit tre paralllise selon cette politique.
+ */
+bool PolitiqueExecution::doitParalleliser(const size_t _dimension) const {
+    return mode == PARALLELE && _dimension >= seuil && _dimension > 1;
+}
+
+namespace
+{
+    /** \brief Taille des morceaux pour une politique donne. En mode rapide, on vise 4 morceaux par fil (pour que le vol de tches puisse quilibrer
+     * la charge), sans descendre sous une taille minimale qui rendrait la coordination trop coteuse.
+     */
+    size_t tailleMorceau(const size_t _dimension, const PolitiqueExecution & _politique){
+        if (_politique.deterministe){
+            return PolitiqueExecution::TAILLE_MORCEAU_DETERMINISTE;
+        }
+        const size_t nombreFils = ReservoirTaches::global().getNombreTravailleurs() + 1;
+        const size_t taille = (_dimension + 4 * nombreFils - 1) / (4 * nombreFils);
+        const size_t tailleMinimale = 4096;
+        return taille < tailleMinimale ? tailleMinimale : taille;
+    }
+}
+
+void Parallele::pourChaqueMorceau(const size_t _dimension, const PolitiqueExecution & _politique, const function<void(size_t, size_t)> & _corps,
+                                  const size_t _elementsParUnite){
+    const size_t elementsParUnite = _elementsParUnite == 0 ? 1 : _elementsParUnite;
+    if (_dimension < 2 || !_politique.doitParalleliser(_dimension * elementsParUnite)){
+        _corps(0, _dimension);
+        return;
+    }
+    const size_t tailleEnElements = tailleMorceau(_dimension * elementsParUnite, _politique);
+    const size_t taille = tailleEnElements / elementsParUnite > 0 ? tailleEnElements / elementsParUnite : 1;
+    const size_t nombreMorceaux = (_dimension + taille - 1) / taille;
+    ReservoirTaches::global().paralleliser(nombreMorceaux, [&](const size_t _morceau){
+        const size_t debut = _morceau * taille;
+        const size_t fin = debut + taille < _dimension ? debut + taille : _dimension;
+        _corps(debut, fin);
+    });
+}
+
+double Parallele::reduire(const size_t _dimension, const PolitiqueExecution & _politique, const function<double(size_t, size_t)> & _partiel,
+                          double (*_combiner)(double, double)){
+    if (!_politique.doitParalleliser(_dimension)){
+        return _partiel(0, _dimension);
+    }
+    const size_t taille = tailleMorceau(_dimension, _politique);
+    const size_t nombreMorceaux = (_dimension + taille - 1) / taille;
+    vector<double> partiels(nombreMorceaux);
+    ReservoirTaches::global().paralleliser(nombreMorceaux, [&](const size_t _morceau){
+        const size_t debut = _morceau * taille;
+        const size_t fin = debut + taille < _dimension ? debut + taille : _dimension;
+        partiels[_morceau] = _partiel(debut, fin);
+    });
+    double retour = partiels[0];
+    for (size_t i = 1; i < nombreMorceaux; i++){
+        retour = _combiner(retour, partiels[i]);
+    }
+    return retour;
+}
@@ -0,0 +1,419 @@
+#include "RechercheVoisins.h"
+#include "Noyaux.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace
+{
+    /** \brief Vrai si `_a` est un meilleur candidat que `_b`: plus grande cl, puis,  galit, plus petit index. Une cl NaN (vecteur qui
+     * contient un NaN) est moins bonne que toutes les autres: sans a, NaN n'est ni plus grand ni plus petit que rien et le tas se corrompt.
+     * C'est un ordre total: le rsultat d'une recherche ne dpend pas de l'ordre dans lequel les candidats sont proposs (ni donc du dcoupage
+     * entre les fils).
+     */
+    bool estMeilleur(const Voisin & _a, const Voisin & _b){
+        const bool aNaN = std::isnan(_a.score);
+        const bool bNaN = std::isnan(_b.score);
+        if (aNaN || bNaN){
+            return aNaN == bNaN ? _a.index < _b.index : bNaN;
+        }
+        return _a.score > _b.score || (_a.score == _b.score && _a.index < _b.index);
+    }
+
+    /** \brief Vrai si la distance de `_a` est plus petite que celle de `_b` (mme ordre total que `estMeilleur`, NaN en dernier).
+     */
+    bool estPlusProche(const Voisin & _a, const Voisin & _b){
+        return estMeilleur(Voisin{_a.index, -_a.score}, Voisin{_b.index, -_b.score});
+    }
+
+    /** \brief Les k meilleurs candidats vus jusqu'ici, dans un tas dont le sommet est le pire d'entre eux. Un candidat moins bon que le sommet
+     * est rejet en une comparaison; sinon, il remplace le sommet en O(log k).
+     */
+    class TasBorne
+    {
+        public:
+            /** \param _k: nombre de candidats  garder.
+             * \param _nombreCandidats: nombre de candidats qui seront proposs au plus; on ne rserve pas plus (`_k` peut tre immense).
+             */
+            TasBorne(const size_t _k, const size_t _nombreCandidats) : k(_k) {
+                elements.reserve(min(_k, _nombreCandidats));
+            }
+
+            void proposer(const size_t _index, const double _cle){
+                const Voisin candidat = {_index, _cle};
+                if (elements.size() < k){
+                    elements.push_back(candidat);
+                    push_heap(elements.begin(), elements.end(), estMeilleur);
+                }
+                else if (k > 0 && estMeilleur(candidat, elements.front())){
+                    pop_heap(elements.begin(), elements.end(), estMeilleur);
+                    elements.back() = candidat;
+                    push_heap(elements.begin(), elements.end(), estMeilleur);
+                }
+            }
+
+            void fusionner(const TasBorne & _autre){
+                for (size_t i = 0; i < _autre.elements.size(); i++){
+                    proposer(_autre.elements[i].index, _autre.elements[i].score);
+                }
+            }
+
+            /** \brief Vide le tas et retourne ses lments, du meilleur au moins bon.
+             */
+            vector<Voisin> extraire(){
+                sort_heap(elements.begin(), elements.end(), estMeilleur);
+                vector<Voisin> retour;
+                retour.swap(elements);
+                return retour;
+            }
+
+        private:
+            size_t k;
+            vector<Voisin> elements;
+    };
+
+    /** \brief Cl  maximiser pour un vecteur,  partir de son produit scalaire avec la requte et de sa norme (prcalcule). Pour le cosinus,
+     * on ne divise pas par la norme de la requte, qui est la mme pour tous les vecteurs; pour L2, 2 q  x - ||x||^2 = ||q||^2 - ||q - x||^2.
+     */
+    inline double cle(const RechercheVoisins::Metrique _metrique, const double _produit, const double _norme){
+        switch (_metrique){
+            case RechercheVoisins::COSINUS:
+                return _norme > 0 ? _produit / _norme : 0;
+            case RechercheVoisins::L2:
+                return 2 * _produit - _norme * _norme;
+            default:
+                return _produit;
+        }
+    }
+
+    /** \brief Propose au tas les lignes [_debut, _fin) d'un lot, compares  la requte.
+     */
+    void parcourir(const VecteurBatch & _lignes, const vector<double> & _normes, const RechercheVoisins::Metrique _metrique,
+                   const double * _requete, const size_t _debut, const size_t _fin, TasBorne & _tas){
+        if (_debut >= _fin){
+            return;
+        }
+        const size_t dimension = _lignes.getDimension();
+        const size_t pas = _lignes.getPas();
+        const double * ligne = _lignes.ligne(_debut);
+        for (size_t i = _debut; i < _fin; i++, ligne += pas){
+            _tas.proposer(i, cle(_metrique, Noyaux::produitScalaire(ligne, _requete, dimension), _normes[i]));
+        }
+    }
+
+    /** \brief Transforme les cls des candidats retenus en scores (voir RechercheVoisins::Metrique), les trie du meilleur au moins bon, et remplace
+     * les positions dans `_lignes` par les index d'origine (`_indices`, si les lignes ont t rordonnes).
+     */
+    vector<Voisin> terminer(TasBorne & _tas, const RechercheVoisins::Metrique _metrique, const double * _requete, const VecteurBatch & _lignes,
+                            const vector<size_t> * _indices){
+        vector<Voisin> retour = _tas.extraire();
+        if (_metrique == RechercheVoisins::COSINUS){
+            const double normeRequete = sqrt(Noyaux::sommeCarres(_requete, _lignes.getDimension()));
+            for (size_t i = 0; i < retour.size(); i++){
+                retour[i].score = normeRequete > 0 ? retour[i].score / normeRequete : 0;
+            }
+        }
+        else if (_metrique == RechercheVoisins::L2){
+            // Distance recalcule directement: ||q||^2 - cl perd sa prcision quand la requte est presque gale au vecteur.
+            for (size_t i = 0; i < retour.size(); i++){
+                retour[i].score = sqrt(Noyaux::distanceCarree(_requete, _lignes.ligne(retour[i].index), _lignes.getDimension()));
+            }
+            sort(retour.begin(), retour.end(), estPlusProche);
+        }
+        if (_indices != nullptr){
+            for (size_t i = 0; i < retour.size(); i++){
+                retour[i].index = (*_indices)[retour[i].index];
+            }
+        }
+        return retour;
+    }
+
+    /** \brief Norme de chaque ligne d'un lot.
+     */
+    vector<double> normesLignes(const VecteurBatch & _lignes){
+        vector<double> retour(_lignes.getNombreLignes());
+        for (size_t i = 0; i < retour.size(); i++){
+            retour[i] = sqrt(Noyaux::sommeCarres(_lignes.ligne(i), _lignes.getDimension()));
+        }
+        return retour;
+    }
+
+    /** \brief Divise une ligne par sa norme (laisse telle quelle si elle est nulle).
+     */
+    void normaliserLigne(double * _ligne, const size_t _dimension){
+        const double norme = sqrt(Noyaux::sommeCarres(_ligne, _dimension));
+        if (norme > 0){
+            Noyaux::diviserScalaire(_ligne, norme, _dimension);
+        }
+    }
+
+    /** \brief Pour chacune des lignes `_lignes[_choisies[i]]`, index du centre le plus proche (distance L2), calcul comme le plus grand
+     * 2 x  c - ||c||^2.
+     */
+    void assigner(const VecteurBatch & _lignes, const vector<size_t> & _choisies, const VecteurBatch & _centres, const vector<double> & _normesCentres,
+                  vector<size_t> & _assignations, const PolitiqueExecution & _politique){
+        Parallele::pourChaqueMorceau(_choisies.size(), _politique, [&](const size_t _debut, const size_t _fin){
+            for (size_t i = _debut; i < _fin; i++){
+                TasBorne plusProche(1, _centres.getNombreLignes());
+                parcourir(_centres, _normesCentres, RechercheVoisins::L2, _lignes.ligne(_choisies[i]), 0, _centres.getNombreLignes(), plusProche);
+                _assignations[i] = plusProche.extraire()[0].index;
+            }
+        }, _lignes.getDimension() * _centres.getNombreLignes());
+    }
+}
+
+/** \brief Constructeur de la classe RechercheVoisins. Copie les vecteurs et prcalcule leurs normes.
+ * \param _vecteurs: collection dans laquelle on cherche (une ligne par vecteur). L'index d'un voisin est le numro de sa ligne.
+ * \param _metrique: mtrique de similarit.
+ */
+RechercheVoisins::RechercheVoisins(const VecteurBatch & _vecteurs, const Metrique _metrique)
+    : vecteurs(_vecteurs), metrique(_metrique)
+{
+    preparer();
+}
+
+/** \brief Variante du constructeur qui prend la mmoire du lot au lieu de le copier.
+ * \param _vecteurs: collection dans laquelle on cherche. Il devient vide.
+ * \param _metrique: mtrique de similarit.
+ */
+RechercheVoisins::RechercheVoisins(VecteurBatch && _vecteurs, const Metrique _metrique)
+    : vecteurs(move(_vecteurs)), metrique(_metrique)
+{
+    preparer();
+}
+
+/** \brief Variante du constructeur  partir de Vecteurs (tous de mme dimension), copis dans un lot contigu.
+ * \param _vecteurs: collection dans laquelle on cherche. L'index d'un voisin est sa position dans `_vecteurs`.
+ * \param _metrique: mtrique de similarit.
+ */
+RechercheVoisins::RechercheVoisins(const vector<Vecteur> & _vecteurs, const Metrique _metrique)
+    : vecteurs(_vecteurs), metrique(_metrique)
+{
+    preparer();
+}
+
+/** \brief Les `_k` vecteurs les plus semblables  la requte.
+ * \param _requete: Vecteur de mme dimension que la collection.
+ * \param _k: nombre de voisins voulus. S'il y a moins de `_k` vecteurs, on les retourne tous.
+ * \param _politique: politique d'excution (les vecteurs sont rpartis entre les fils, chacun avec son propre tas).
+ * \return Les voisins, du meilleur au moins bon.
+ */
+vector<Voisin> RechercheVoisins::chercher(const Vecteur & _requete, const size_t _k, const PolitiqueExecution & _politique) const {
+    verifierDimension(_requete.getDimension());
+    const double * requete = _requete.data();
+    TasBorne meilleurs(_k, vecteurs.getNombreLignes());
+    mutex verrou;
+    Parallele::pourChaqueMorceau(vecteurs.getNombreLignes(), _politique, [&](const size_t _debut, const size_t _fin){
+        TasBorne local(_k, _fin - _debut);
+        parcourir(vecteurs, normes, metrique, requete, _debut, _fin, local);
+        lock_guard<mutex> garde(verrou);
+        meilleurs.fusionner(local);
+    }, vecteurs.getDimension());
+    return terminer(meilleurs, metrique, requete, vecteurs, nullptr);
+}
+
+/** \brief Variante pour plusieurs requtes  la fois, parcourue par tuiles (voir la description de la classe). Le rsultat de chaque requte est
+ * identique  celui de `chercher(const Vecteur &, ...)`.
+ * \param _requetes: une requte par ligne, de mme dimension que la collection.
+ * \param _k: nombre de voisins voulus par requte.
+ * \param _politique: politique d'excution (les blocs de requtes sont rpartis entre les fils).
+ * \return Pour chaque requte, ses voisins, du meilleur au moins bon.
+ */
+vector<vector<Voisin> > RechercheVoisins::chercher(const VecteurBatch & _requetes, const size_t _k, const PolitiqueExecution & _politique) const {
+    verifierDimension(_requetes.getDimension());
+    const size_t nombreVecteurs = vecteurs.getNombreLignes();
+    const size_t nombreRequetes = _requetes.getNombreLignes();
+    // Tuiles d'environ 128 Ko de vecteurs (comme VecteurBatch::produitsScalaires), compares  16 requtes (qui restent dans la cache L1).
+    const size_t lignesParTuile = vecteurs.getPas() > 0 && 16384 / vecteurs.getPas() > 0 ? 16384 / vecteurs.getPas() : 1;
+    const size_t requetesParBloc = 16;
+    const size_t nombreBlocs = (nombreRequetes + requetesParBloc - 1) / requetesParBloc;
+    vector<TasBorne> tas(nombreRequetes, TasBorne(_k, nombreVecteurs));
+    Parallele::pourChaqueMorceau(nombreBlocs, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t bloc = _debut; bloc < _fin; bloc++){
+            const size_t debutRequetes = bloc * requetesParBloc;
+            const size_t finRequetes = min(debutRequetes + requetesParBloc, nombreRequetes);
+            for (size_t debutTuile = 0; debutTuile < nombreVecteurs; debutTuile += lignesParTuile){
+                const size_t finTuile = min(debutTuile + lignesParTuile, nombreVecteurs);
+                for (size_t j = debutRequetes; j < finRequetes; j++){
+                    parcourir(vecteurs, normes, metrique, _requetes.ligne(j), debutTuile, finTuile, tas[j]);
+                }
+            }
+        }
+    }, requetesParBloc * (nombreVecteurs > 0 ? nombreVecteurs : 1) * vecteurs.getDimension());
+    vector<vector<Voisin> > retour(nombreRequetes);
+    for (size_t j = 0; j < nombreRequetes; j++){
+        retour[j] = terminer(tas[j], metrique, _requetes.ligne(j), vecteurs, nullptr);
+    }
+    return retour;
+}
+
+size_t RechercheVoisins::getNombreVecteurs() const {
+    return vecteurs.getNombreLignes();
+}
+
+size_t RechercheVoisins::getDimension() const {
+    return vecteurs.getDimension();
+}
+
+RechercheVoisins::Metrique RechercheVoisins::getMetrique() const {
+    return metrique;
+}
+
+const VecteurBatch & RechercheVoisins::getVecteurs() const {
+    return vecteurs;
+}
+
+void RechercheVoisins::preparer(){
+    normes = normesLignes(vecteurs);
+}
+
+void RechercheVoisins::verifierDimension(const size_t _dimension) const {
+    if (_dimension != vecteurs.getDimension()){
+        throw runtime_error("La dimension de la requte ne concorde pas avec celle des vecteurs.");
+    }
+}
+
+/** \brief Constructeur de la classe IndexIVF: entrane les centres des listes (k-moyennes) et range les vecteurs liste par liste.
+ * \param _vecteurs: collection dans laquelle on cherche. L'index d'un voisin est le numro de sa ligne.
+ * \param _metrique: mtrique de similarit.
+ * \param _nombreListes: nombre de listes (de groupes), entre 1 et le nombre de vecteurs. Environ sqrt(n) est un bon point de dpart.
+ * \param _iterations: nombre d'itrations des k-moyennes.
+ * \param _graine: graine du tirage des centres initiaux et de l'chantillon d'entranement.
+ * \param _politique: politique d'excution de l'entranement (les vecteurs  assigner sont rpartis entre les fils).
+ */
+IndexIVF::IndexIVF(const VecteurBatch & _vecteurs, const RechercheVoisins::Metrique _metrique, const size_t _nombreListes,
+                   const size_t _iterations, const unsigned _graine, const PolitiqueExecution & _politique)
+    : metrique(_metrique), centres(_nombreListes, _vecteurs.getDimension()), vecteurs(_vecteurs.getNombreLignes(), _vecteurs.getDimension())
+{
+    const size_t nombreVecteurs = _vecteurs.getNombreLignes();
+    const size_t dimension = _vecteurs.getDimension();
+    if (_nombreListes == 0 || _nombreListes > nombreVecteurs){
+        throw runtime_error("Le nombre de listes doit tre entre 1 et le nombre de vecteurs.");
+    }
+    VecteurBatch donnees(_vecteurs);
+    if (metrique == RechercheVoisins::COSINUS){
+        for (size_t i = 0; i < nombreVecteurs; i++){
+            normaliserLigne(donnees.ligne(i), dimension);
+        }
+    }
+
+    // Centres initiaux et chantillon d'entranement: les premiers vecteurs d'un ordre alatoire.
+    mt19937_64 generateur(_graine);
+    vector<size_t> ordre(nombreVecteurs);
+    iota(ordre.begin(), ordre.end(), size_t(0));
+    shuffle(ordre.begin(), ordre.end(), generateur);
+    vector<size_t> echantillon(ordre.begin(), ordre.begin() + min(nombreVecteurs, 256 * _nombreListes));
+    for (size_t c = 0; c < _nombreListes; c++){
+        copy(donnees.ligne(echantillon[c]), donnees.ligne(echantillon[c]) + dimension, centres.ligne(c));
+    }
+
+    vector<size_t> assignations(echantillon.size());
+    vector<double> sommes(_nombreListes * dimension);
+    vector<size_t> tailles(_nombreListes);
+    for (size_t iteration = 0; iteration < _iterations; iteration++){
+        normesCentres = normesLignes(centres);
+        assigner(donnees, echantillon, centres, normesCentres, assignations, _politique);
+        fill(sommes.begin(), sommes.end(), 0.0);
+        fill(tailles.begin(), tailles.end(), size_t(0));
+        for (size_t i = 0; i < echantillon.size(); i++){
+            const double * ligne = donnees.ligne(echantillon[i]);
+            double * somme = sommes.data() + assignations[i] * dimension;
+            for (size_t j = 0; j < dimension; j++){
+                somme[j] += ligne[j];
+            }
+            tailles[assignations[i]]++;
+        }
+        for (size_t c = 0; c < _nombreListes; c++){
+            if (tailles[c] == 0){
+                continue;
+            }
+            double * centre = centres.ligne(c);
+            for (size_t j = 0; j < dimension; j++){
+                centre[j] = sommes[c * dimension + j] / double(tailles[c]);
+            }
+            if (metrique == RechercheVoisins::COSINUS){
+                normaliserLigne(centre, dimension);
+            }
+        }
+    }
+    normesCentres = normesLignes(centres);
+
+    // Assignation finale de tous les vecteurs, puis rangement contigu, liste par liste (dans l'ordre des index  l'intrieur d'une liste).
+    vector<size_t> tous(nombreVecteurs);
+    iota(tous.begin(), tous.end(), size_t(0));
+    vector<size_t> listes(nombreVecteurs);
+    assigner(donnees, tous, centres, normesCentres, listes, _politique);
+    debutsListes.assign(_nombreListes + 1, 0);
+    for (size_t i = 0; i < nombreVecteurs; i++){
+        debutsListes[listes[i] + 1]++;
+    }
+    partial_sum(debutsListes.begin(), debutsListes.end(), debutsListes.begin());
+    vector<size_t> positions(debutsListes.begin(), debutsListes.end() - 1);
+    indices.resize(nombreVecteurs);
+    for (size_t i = 0; i < nombreVecteurs; i++){
+        const size_t position = positions[listes[i]]++;
+        copy(donnees.ligne(i), donnees.ligne(i) + dimension, vecteurs.ligne(position));
+        indices[position] = i;
+    }
+    normes = normesLignes(vecteurs);
+}
+
+/** \brief Les `_k` vecteurs les plus semblables  la requte parmi ceux des `_nombreSondes` listes les plus proches (approximatif, voir la
+ * description de la classe).
+ * \param _requete: Vecteur de mme dimension que la collection.
+ * \param _k: nombre de voisins voulus.
+ * \param _nombreSondes: nombre de listes parcourues (au moins 1; au-del du nombre de listes, on les parcourt toutes).
+ * \return Les voisins, du meilleur au moins bon, avec leur index dans la collection d'origine.
+ */
+vector<Voisin> IndexIVF::chercher(const Vecteur & _requete, const size_t _k, const size_t _nombreSondes) const {
+    if (_requete.getDimension() != vecteurs.getDimension()){
+        throw runtime_error("La dimension de la requte ne concorde pas avec celle des vecteurs.");
+    }
+    if (_nombreSondes == 0){
+        throw runtime_error("Il faut sonder au moins une liste.");
+    }
+    const double * requete = _requete.data();
+    TasBorne sondes(_nombreSondes, centres.getNombreLignes());
+    parcourir(centres, normesCentres, metrique, requete, 0, centres.getNombreLignes(), sondes);
+    const vector<Voisin> listes = sondes.extraire();
+    size_t nombreCandidats = 0;
+    for (size_t i = 0; i < listes.size(); i++){
+        nombreCandidats += debutsListes[listes[i].index + 1] - debutsListes[listes[i].index];
+    }
+    TasBorne meilleurs(_k, nombreCandidats);
+    for (size_t i = 0; i < listes.size(); i++){
+        parcourir(vecteurs, normes, metrique, requete, debutsListes[listes[i].index], debutsListes[listes[i].index + 1], meilleurs);
+    }
+    return terminer(meilleurs, metrique, requete, vecteurs, &indices);
+}
+
+size_t IndexIVF::getNombreVecteurs() const {
+    return vecteurs.getNombreLignes();
+}
+
+size_t IndexIVF::getDimension() const {
+    return vecteurs.getDimension();
+}
+
+size_t IndexIVF::getNombreListes() const {
+    return centres.getNombreLignes();
+}
+
+/** \brief Nombre de vecteurs rangs dans une liste.
+ * \param _liste: index de la liste.
+ * \return Le nombre de vecteurs de la liste.
+ */
+size_t IndexIVF::getTailleListe(const size_t _liste) const {
+    if (_liste >= centres.getNombreLignes()){
+        throw runtime_error("L'index de liste est en-dehors de l'index.");
+    }
+    return debutsListes[_liste + 1] - debutsListes[_liste];
+}
+
+RechercheVoisins::Metrique IndexIVF::getMetrique() const {
+    return metrique;
+}
@@ -0,0 +1,180 @@
+#include "ReservoirTaches.h"
+
+#include <exception>
+
+namespace
+{
+    // Identifie le rservoir et l'index du travailleur qui excute le fil courant (aucun si le fil ne fait pas partie d'un rservoir).
+    thread_local const ReservoirTaches * reservoirCourant = nullptr;
+    thread_local size_t indexTravailleurCourant = 0;
+}
+
+/** \brief Constructeur. Dmarre `_nombreTravailleurs` fils d'excution, chacun avec sa propre file de tches.
+ * \param _nombreTravailleurs: nombre de fils  dmarrer (au moins 1).
+ */
+ReservoirTaches::ReservoirTaches(const size_t _nombreTravailleurs)
+    : tachesEnAttente(0), prochaineFile(0), arret(false)
+{
+    const size_t nombre = _nombreTravailleurs == 0 ? 1 : _nombreTravailleurs;
+    for (size_t i = 0; i < nombre; i++){
+        files.push_back(unique_ptr<FileTravailleur>(new FileTravailleur()));
+    }
+    for (size_t i = 0; i < nombre; i++){
+        travailleurs.push_back(thread(&ReservoirTaches::boucleTravailleur, this, i));
+    }
+}
+
+/** \brief Destructeur. Les tches dj soumises sont termines, puis on attend la fin de tous les fils.
+ */
+ReservoirTaches::~ReservoirTaches()
+{
+    {
+        lock_guard<mutex> verrou(verrouSommeil);
+        arret = true;
+    }
+    reveil.notify_all();
+    for (size_t i = 0; i < travailleurs.size(); i++){
+        travailleurs[i].join();
+    }
+}
+
+/** \brief Rservoir partag par toute l'application. Il utilise un fil par coeur logique, moins un: le fil qui appelle `paralleliser(...)` travaille
+ * lui aussi.
+ * \return Le rservoir global (cr au premier appel).
+ */
+ReservoirTaches & ReservoirTaches::global(){
+    static ReservoirTaches reservoir(thread::hardware_concurrency() > 1 ? thread::hardware_concurrency() - 1 : 1);
+    return reservoir;
+}
+
+/** \brief Rservoir spar pour les tches qui attendent surtout des entres/sorties (lecture ou criture de fichiers, rseau). Ses fils passent
+ * la plupart de leur temps bloqus: en les gardant hors du rservoir global, une lecture lente n'occupe jamais un coeur rserv au calcul, et les
+ * entres/sorties se font pendant que le rservoir global calcule (voir ExecutionAsynchrone.h).
+ * \return Le rservoir d'entres/sorties (4 fils, cr au premier appel).
+ */
+ReservoirTaches & ReservoirTaches::entreesSorties(){
+    static ReservoirTaches reservoir(4);
+    return reservoir;
+}
+
+/** \brief Nombre de fils travailleurs du rservoir (sans compter le fil appelant).
+ */
+size_t ReservoirTaches::getNombreTravailleurs() const {
+    return travailleurs.size();
+}
+
+/** \brief Ajoute une tche  excuter plus tard par un travailleur. Si on est dj sur un travailleur, la tche va dans sa propre file (elle sera
+ * probablement excute par lui,  moins qu'un autre la vole). Sinon, on rpartit les tches  tour de rle entre les files.
+ * La tche ne doit pas lancer d'exception (sinon, std::terminate).
+ * \param _tache: tche  excuter.
+ */
+void ReservoirTaches::soumettre(function<void()> _tache){
+    const size_t index = reservoirCourant == this ? indexTravailleurCourant : prochaineFile.fetch_add(1, memory_order_relaxed) % files.size();
+    // On compte la tche avant de l'ajouter: le compteur ne peut donc jamais devenir ngatif quand un travailleur la retire.
+    tachesEnAttente.fetch_add(1, memory_order_release);
+    {
+        lock_guard<mutex> verrou(files[index]->verrou);
+        files[index]->taches.push_back(move(_tache));
+    }
+    {
+        lock_guard<mutex> verrou(verrouSommeil);
+    }
+    reveil.notify_one();
+}
+
+/** \brief Excute `_corps(0)`, `_corps(1)`, ..., `_corps(_nombreMorceaux - 1)` en parallle et attend qu'ils soient tous termins.
+ * Le fil appelant excute lui-mme le premier morceau, puis aide les travailleurs (en excutant des tches) jusqu' la fin. Si un morceau lance une
+ * exception, elle est relance ici une fois tous les morceaux termins.
+ * \param _nombreMorceaux: nombre de morceaux de travail.
+ * \param _corps: fonction  appeler pour chaque morceau (reoit l'index du morceau).
+ */
+void ReservoirTaches::paralleliser(const size_t _nombreMorceaux, const function<void(size_t)> & _corps){
+    if (_nombreMorceaux == 0){
+        return;
+    }
+    atomic<size_t> restants(_nombreMorceaux);
+    exception_ptr erreur;
+    mutex verrouErreur;
+    auto executer = [&](const size_t _morceau){
+        try {
+            _corps(_morceau);
+        }
+        catch (...){
+            lock_guard<mutex> verrou(verrouErreur);
+            if (!erreur){
+                erreur = current_exception();
+            }
+        }
+        restants.fetch_sub(1, memory_order_acq_rel);
+    };
+    for (size_t morceau = 1; morceau < _nombreMorceaux; morceau++){
+        soumettre([&executer, morceau]() { executer(morceau); });
+    }
+    executer(0);
+    const size_t indexPrefere = reservoirCourant == this ? indexTravailleurCourant : 0;
+    while (restants.load(memory_order_acquire) != 0){
+        if (!executerUneTache(indexPrefere)){
+            this_thread::yield();
+        }
+    }
+    if (erreur){
+        rethrow_exception(erreur);
+    }
+}
+
+/** \brief Excute une tche en attente sur le fil courant, s'il y en a une. Sert  un fil qui doit attendre que des tches du rservoir se
+ * terminent (par exemple quand une file borne est pleine): plutt que de dormir, il fait avancer le travail, et on ne risque pas d'interblocage
+ * si ce fil est lui-mme un travailleur.
+ * \return true si une tche a t excute.
+ */
+bool ReservoirTaches::aider(){
+    return executerUneTache(reservoirCourant == this ? indexTravailleurCourant : 0);
+}
+
+/** \brief Excute une tche, s'il y en a une: d'abord  l'arrire de la file prfre, sinon en volant  l'avant des autres files.
+ * \param _indexPrefere: index de la file  consulter en premier.
+ * \return true si une tche a t excute.
+ */
+bool ReservoirTaches::executerUneTache(const size_t _indexPrefere){
+    function<void()> tache;
+    const size_t nombreFiles = files.size();
+    for (size_t decalage = 0; decalage < nombreFiles && !tache; decalage++){
+        FileTravailleur & file = *files[(_indexPrefere + decalage) % nombreFiles];
+        lock_guard<mutex> verrou(file.verrou);
+        if (file.taches.empty()){
+            continue;
+        }
+        if (decalage == 0){
+            tache = move(file.taches.back());
+            file.taches.pop_back();
+        }
+        else {
+            tache = move(file.taches.front());
+            file.taches.pop_front();
+        }
+    }
+    if (!tache){
+        return false;
+    }
+    tachesEnAttente.fetch_sub(1, memory_order_acq_rel);
+    tache();
+    return true;
+}
+
+/** \brief Boucle principale d'un travailleur: excuter des tches tant qu'il y en a, dormir sinon.
+ * \param _index: index du travailleur (et de sa file).
+ */
+void ReservoirTaches::boucleTravailleur(const size_t _index){
+    reservoirCourant = this;
+    indexTravailleurCourant = _index;
+    while (true){
+        if (executerUneTache(_index)){
+            continue;
+        }
+        unique_lock<mutex> verrou(verrouSommeil);
+        reveil.wait(verrou, [this]() { return arret || tachesEnAttente.load(memory_order_acquire) > 0; });
+        if (arret && tachesEnAttente.load(memory_order_acquire) == 0){
+            return;
+        }
+    }
+}
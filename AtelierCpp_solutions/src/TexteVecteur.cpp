@@ -0,0 +1,252 @@
+#include "TexteVecteur.h"
+
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+    const size_t TAILLE_MORCEAU = 1 << 16;
+    const size_t TAILLE_MAXIMALE_ELEMENT = 24; // "-2.2250738585072014e-308"
+
+    bool estBlanc(const char _caractere){
+        return _caractere == ' ' || _caractere == '\t' || _caractere == '\n' || _caractere == '\r' || _caractere == '\f' || _caractere == '\v';
+    }
+
+    /** \brief Analyseur du format `[a\tb\tc]` qui reoit le texte par morceaux quelconques. Un lment coup entre deux morceaux est gard dans
+     * `jeton` jusqu'au morceau suivant; tous les autres sont convertis directement dans le morceau, sans copie.
+     */
+    class Analyseur
+    {
+        public:
+            explicit Analyseur(pmr::vector<double> & _valeurs) : valeurs(_valeurs), etat(AVANT_CROCHET), tailleJeton(0) {
+                valeurs.clear();
+            }
+
+            void ajouter(const char * _debut, const char * _fin){
+                const char * p = _debut;
+                while (p < _fin){
+                    if (etat == TERMINE){
+                        if (!estBlanc(*p)){
+                            throw runtime_error("Texte invalide: caractres aprs le crochet fermant.");
+                        }
+                        p++;
+                    }
+                    else if (etat == AVANT_CROCHET){
+                        if (*p == '['){
+                            etat = ELEMENTS;
+                        }
+                        else if (!estBlanc(*p)){
+                            throw runtime_error("Texte invalide: un vecteur doit commencer par '['.");
+                        }
+                        p++;
+                    }
+                    else if (tailleJeton == 0 && estBlanc(*p)){
+                        p++;
+                    }
+                    else if (tailleJeton == 0 && *p == ']'){
+                        etat = TERMINE;
+                        p++;
+                    }
+                    else {
+                        const char * finJeton = p;
+                        while (finJeton < _fin && !estBlanc(*finJeton) && *finJeton != ']'){
+                            finJeton++;
+                        }
+                        if (tailleJeton == 0 && finJeton < _fin){
+                            convertir(p, finJeton);
+                        }
+                        else {
+                            const size_t taille = size_t(finJeton - p);
+                            if (tailleJeton + taille > sizeof(jeton)){
+                                throw runtime_error("Texte invalide: lment trop long.");
+                            }
+                            memcpy(jeton + tailleJeton, p, taille);
+                            tailleJeton += taille;
+                            if (finJeton < _fin){
+                                convertir(jeton, jeton + tailleJeton);
+                                tailleJeton = 0;
+                            }
+                        }
+                        p = finJeton;
+                    }
+                }
+            }
+
+            void terminer(){
+                if (etat != TERMINE){
+                    throw runtime_error("Texte invalide: le vecteur se termine sans ']'.");
+                }
+            }
+
+        private:
+            enum Etat
+            {
+                AVANT_CROCHET,
+                ELEMENTS,
+                TERMINE
+            };
+
+            void convertir(const char * _debut, const char * _fin){
+                if (_debut < _fin && *_debut == '+'){
+                    _debut++;
+                }
+                double valeur = 0;
+                const from_chars_result resultat = from_chars(_debut, _fin, valeur);
+                if (resultat.ec != errc() || resultat.ptr != _fin){
+                    throw runtime_error("Texte invalide: '" + string(_debut, _fin) + "' n'est pas un nombre.");
+                }
+                valeurs.push_back(valeur);
+            }
+
+            pmr::vector<double> & valeurs;
+            Etat etat;
+            char jeton[64];
+            size_t tailleJeton;
+    };
+}
+
+/** \brief Nombre maximal de caractres pour crire un Vecteur: les crochets, plus chaque lment et son sparateur. Un tampon de cette taille
+ * (jamais moins que TAILLE_MINIMALE_TAMPON) reoit tout le texte sans tre vid en cours de route.
+ * \param _dimension: dimension du Vecteur.
+ * \return Le nombre de caractres.
+ */
+size_t TexteVecteur::tailleMaximale(const size_t _dimension){
+    return max(TAILLE_MINIMALE_TAMPON, 2 + _dimension * (TAILLE_MAXIMALE_ELEMENT + 1));
+}
+
+/** \brief crit le Vecteur dans le tampon de l'appelant, en le vidant avec `_vider` chaque fois qu'il manque de place pour un lment.
+ * \param _vecteur: lments  crire.
+ * \param _tampon: tampon de l'appelant.
+ * \param _tailleTampon: taille du tampon, au moins TAILLE_MINIMALE_TAMPON.
+ * \param _vider: reoit chaque morceau de texte.
+ */
+void TexteVecteur::formater(const VecteurVueConst & _vecteur, char * _tampon, const size_t _tailleTampon,
+                            const function<void(const char *, size_t)> & _vider){
+    if (_tailleTampon < TAILLE_MINIMALE_TAMPON){
+        throw runtime_error("Le tampon est trop petit pour crire un vecteur.");
+    }
+    char * const finTampon = _tampon + _tailleTampon;
+    char * position = _tampon;
+    *position++ = '[';
+    const size_t dimension = _vecteur.getDimension();
+    for (size_t i = 0; i < dimension; i++){
+        if (size_t(finTampon - position) < TAILLE_MAXIMALE_ELEMENT + 2){
+            _vider(_tampon, size_t(position - _tampon));
+            position = _tampon;
+        }
+        position = to_chars(position, finTampon, _vecteur.evaluer(i)).ptr;
+        if (i + 1 != dimension){
+            *position++ = '\t';
+        }
+    }
+    *position++ = ']';
+    _vider(_tampon, size_t(position - _tampon));
+}
+
+/** \brief crit le texte dans un descripteur de fichier.
+ * \param _vecteur: lments  crire.
+ * \param _descripteur: descripteur ouvert en criture (par exemple 1 pour la sortie standard).
+ */
+void TexteVecteur::ecrire(const VecteurVueConst & _vecteur, const int _descripteur){
+    vector<char> tampon(TAILLE_MORCEAU);
+    formater(_vecteur, tampon.data(), tampon.size(), [_descripteur](const char * _morceau, size_t _taille){
+        while (_taille > 0){
+#ifdef _WIN32
+            const int ecrits = _write(_descripteur, _morceau, unsigned(_taille));
+#else
+            const ssize_t ecrits = write(_descripteur, _morceau, _taille);
+#endif
+            if (ecrits <= 0){
+                throw runtime_error("Erreur d'criture dans le descripteur de fichier.");
+            }
+            _morceau += ecrits;
+            _taille -= size_t(ecrits);
+        }
+    });
+}
+
+/** \brief crit le texte dans un flux.
+ * \param _vecteur: lments  crire.
+ * \param _sortie: flux de sortie.
+ */
+void TexteVecteur::ecrire(const VecteurVueConst & _vecteur, ostream & _sortie){
+    vector<char> tampon(TAILLE_MORCEAU);
+    formater(_vecteur, tampon.data(), tampon.size(), [&_sortie](const char * _morceau, const size_t _taille){
+        _sortie.write(_morceau, streamsize(_taille));
+    });
+}
+
+/** \brief Lit le format texte par morceaux.
+ * \param _lire: remplit le tampon reu et retourne le nombre de caractres lus (0 quand il n'y a plus rien  lire).
+ * \param _valeurs: reoit les lments lus.
+ */
+void TexteVecteur::analyser(const function<size_t(char *, size_t)> & _lire, pmr::vector<double> & _valeurs){
+    Analyseur analyseur(_valeurs);
+    vector<char> tampon(TAILLE_MORCEAU);
+    size_t lus;
+    while ((lus = _lire(tampon.data(), tampon.size())) > 0){
+        analyseur.ajouter(tampon.data(), tampon.data() + lus);
+    }
+    analyseur.terminer();
+}
+
+/** \brief Lit un texte complet dj en mmoire, sans copie.
+ * \param _debut: premier caractre.
+ * \param _fin: fin du texte (exclue).
+ * \param _valeurs: reoit les lments lus.
+ */
+void TexteVecteur::analyser(const char * _debut, const char * _fin, pmr::vector<double> & _valeurs){
+    Analyseur analyseur(_valeurs);
+    analyseur.ajouter(_debut, _fin);
+    analyseur.terminer();
+}
+
+/** \brief Lit le texte d'un descripteur de fichier jusqu' la fin du fichier.
+ * \param _descripteur: descripteur ouvert en lecture (par exemple 0 pour l'entre standard).
+ * \param _valeurs: reoit les lments lus.
+ */
+void TexteVecteur::analyser(const int _descripteur, pmr::vector<double> & _valeurs){
+    analyser([_descripteur](char * _tampon, const size_t _taille){
+#ifdef _WIN32
+        const int lus = _read(_descripteur, _tampon, unsigned(_taille));
+#else
+        const ssize_t lus = read(_descripteur, _tampon, _taille);
+#endif
+        if (lus < 0){
+            throw runtime_error("Erreur de lecture dans le descripteur de fichier.");
+        }
+        return size_t(lus);
+    }, _valeurs);
+}
+
+/** \brief Lit le texte d'un flux. La lecture s'arrte juste aprs le crochet fermant: le reste du flux (par exemple un autre vecteur) reste
+ * disponible.
+ * \param _entree: flux d'entre.
+ * \param _valeurs: reoit les lments lus.
+ */
+void TexteVecteur::analyser(istream & _entree, pmr::vector<double> & _valeurs){
+    bool termine = false;
+    analyser([&_entree, &termine](char * _tampon, const size_t _taille){
+        if (termine){
+            return size_t(0);
+        }
+        // get(...) s'arrte avant ']' (sans l'extraire) et ajoute un zro final: on lui laisse donc une place de moins.
+        _entree.get(_tampon, streamsize(_taille), ']');
+        size_t lus = size_t(_entree.gcount());
+        if (lus == 0){
+            _entree.clear(_entree.rdstate() & ~ios::failbit);
+            if (_entree.peek() == ']'){
+                _tampon[lus++] = char(_entree.get());
+                termine = true;
+            }
+        }
+        return lus;
+    }, _valeurs);
+}
@@ -1,4 +1,7 @@
 #include "Vecteur.h"
+#include "InstrumentationVecteur.h"
+#include "Noyaux.h"
+#include "TexteVecteur.h"
 
 /** \brief Destructeur de la classe Vecteur. Sert  s'assurer que les lments internes du Vecteur courant sont dtruits et la mmoire est libre.
  * Techniquement, on pourrait laisser a vide, car la mmoire des lments internes dans le vector<double> est libre dans son destructeur.
@@ -15,18 +18,49 @@ Vecteur::~Vecteur()
  * \param _autre: Vecteur qu'on copie.
  */
 Vecteur::Vecteur(const Vecteur & _autre)
+    : vecteurInterne(PorteeMemoire::ressourceCourante())
 {
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_COPIE, _autre.dimension, 1, _autre.dimension * sizeof(double));
     vecteurInterne = _autre.vecteurInterne;
     dimension = _autre.dimension;
 }
 
+/** \brief Variante du constructeur copie, qui place la copie dans une ressource mmoire prcise (par exemple pour sortir un rsultat d'une arne
+ * avant de la librer: `Vecteur resultat(temporaire, pmr::get_default_resource());`).
+ * \param _autre: Vecteur qu'on copie.
+ * \param _ressource: ressource mmoire de la copie (nullptr: ressource courante du fil, voir MemoireVecteur.h).
+ */
+Vecteur::Vecteur(const Vecteur & _autre, pmr::memory_resource * _ressource)
+    : vecteurInterne(_autre.vecteurInterne, _ressource != nullptr ? _ressource : PorteeMemoire::ressourceCourante())
+{
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_COPIE, _autre.dimension, 1, _autre.dimension * sizeof(double));
+    dimension = _autre.dimension;
+}
+
+/** \brief Constructeur par dplacement (move) de la classe Vecteur.
+ * Sert  crer un nouveau Vecteur en  volant  la mmoire d'un Vecteur qui est sur le point d'tre dtruit (par exemple, le Vecteur retourn par
+ * `cross(...)`). Aucune copie ni allocation: on rcupre simplement le vector<double> interne (et sa ressource mmoire). L'autre Vecteur devient
+ * vide (dimension 0).
+ * \param _autre: Vecteur dont on prend la mmoire.
+ */
+Vecteur::Vecteur(Vecteur && _autre) noexcept
+    : vecteurInterne(move(_autre.vecteurInterne)), dimension(_autre.dimension)
+{
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_DEPLACEMENT, dimension, 0, 0);
+    _autre.dimension = 0;
+}
+
 /** \brief Variante du constructeur de la classe Vecteur.
  * Sert  crer un Vecteur selon une certaine dimension et une certaine valeur initiale. On prend le vecteur interne et on le redimensionne en lui donnant
  * une valeur identique  chaque position.
  * \param _dimension: de type size_t (essentiellement un entier non sign), correspond  la dimension du Vecteur  crer.
  * \param _valeurInitiale: de type double, correspond  la valeur initiale qu'on donne  chaque index du Vecteur.
+ * \param _ressource: ressource mmoire o allouer les lments (par dfaut, nullptr: ressource courante du fil, voir MemoireVecteur.h).
  */
-Vecteur::Vecteur(const size_t _dimension, const double _valeurInitiale){
+Vecteur::Vecteur(const size_t _dimension, const double _valeurInitiale, pmr::memory_resource * _ressource)
+    : vecteurInterne(_ressource != nullptr ? _ressource : PorteeMemoire::ressourceCourante())
+{
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_DIMENSION, _dimension, 1, _dimension * sizeof(double));
     vecteurInterne.resize(_dimension, _valeurInitiale);
     dimension = _dimension;
 }
@@ -35,25 +69,95 @@ Vecteur::Vecteur(const size_t _dimension, const double _valeurInitiale){
  * Sert  crer un Vecteur bas sur un vector<double>. C'est essentiellement les valeurs internes qu'on passe directement en argument. On utilise
  * une nouvelle fois l'oprateur d'assignation du vector<double> pour faire la copie.
  * \param _valeurs: objet vector<double> contenant les valeurs du Vecteur  crer.
+ * \param _ressource: ressource mmoire o allouer les lments (par dfaut, nullptr: ressource courante du fil, voir MemoireVecteur.h).
  */
-Vecteur::Vecteur(const vector<double> & _valeurs){
-    vecteurInterne = _valeurs;
+Vecteur::Vecteur(const vector<double> & _valeurs, pmr::memory_resource * _ressource)
+    : vecteurInterne(_ressource != nullptr ? _ressource : PorteeMemoire::ressourceCourante())
+{
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_VALEURS, _valeurs.size(), 1, _valeurs.size() * sizeof(double));
+    vecteurInterne.assign(_valeurs.begin(), _valeurs.end());
     dimension = _valeurs.size();
 }
 
 /** \brief Variante du constructeur de la classe Vecteur.
  * Sert  crer un Vecteur dont les valeurs sont popules selon un point de dpart (_start), un point de fin (_end, exclu) et un pas (_step).
+ * Le nombre d'lments est calcul d'avance (une seule allocation) et l'lment `i` vaut exactement `_start + i * _step`: l'erreur d'arrondi ne
+ * s'accumule pas d'un lment  l'autre (voir ExpressionIntervalle dans VecteurExpression.h). Le pas peut tre ngatif, mais pas nul.
  * \param _start: Point de dpart.
  * \param _end: Point de fin (exclu).
  * \param _step: Pas.
  */
-Vecteur::Vecteur(const double _start, const double _stop, const double _step){
-    vector<double> interne;
-    for (double i = _start; i < _stop; i += _step){
-        interne.push_back(i);
-    }
-    vecteurInterne = interne;
+Vecteur::Vecteur(const double _start, const double _stop, const double _step)
+    : Vecteur(ExpressionIntervalle(_start, _stop, _step), PolitiqueExecution::sequentielle())
+{
+}
+
+/** \brief Variante parallle du constructeur par intervalle: au-del du seuil de la politique, chaque fil remplit un morceau contigu. Le rsultat
+ * est identique  `Vecteur(_start, _stop, _step)`.
+ * \param _start: Point de dpart.
+ * \param _stop: Point de fin (exclu).
+ * \param _step: Pas.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ */
+Vecteur::Vecteur(const double _start, const double _stop, const double _step, const PolitiqueExecution & _politique)
+    : Vecteur(ExpressionIntervalle(_start, _stop, _step), _politique)
+{
+}
+
+/** \brief Matrialise un intervalle paresseux (voir VecteurExpression.h), par exemple `Vecteur grille(ExpressionIntervalle::espaceLineaire(0, 1, n),
+ * PolitiqueExecution::parallele());`.
+ * \param _intervalle: intervalle  matrialiser.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ */
+Vecteur::Vecteur(const ExpressionIntervalle & _intervalle, const PolitiqueExecution & _politique)
+    : vecteurInterne(PorteeMemoire::ressourceCourante())
+{
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_INTERVALLE, _intervalle.getDimension(), 1, _intervalle.getDimension() * sizeof(double));
+    dimension = _intervalle.getDimension();
+    vecteurInterne.resize(dimension);
+    double * donnees = vecteurInterne.data();
+    Parallele::pourChaqueMorceau(dimension, _politique, [&_intervalle, donnees](const size_t _debut, const size_t _fin){
+        _intervalle.remplir(donnees + _debut, _debut, _fin);
+    });
+}
+
+/** \brief Cre un Vecteur de `_nombre` lments galement espacs entre `_debut` et `_fin` (comme `numpy.linspace`).
+ * \param _debut: premier lment.
+ * \param _fin: dernier lment (exactement), ou borne exclue si `_inclureFin` est faux.
+ * \param _nombre: nombre d'lments.
+ * \param _inclureFin: si vrai (par dfaut), le dernier lment vaut `_fin`.
+ * \return Le Vecteur cr.
+ */
+Vecteur Vecteur::espaceLineaire(const double _debut, const double _fin, const size_t _nombre, const bool _inclureFin){
+    return Vecteur(ExpressionIntervalle::espaceLineaire(_debut, _fin, _nombre, _inclureFin), PolitiqueExecution::sequentielle());
+}
+
+/** \brief Variante parallle de `espaceLineaire(...)`. Rsultat identique.
+ * \param _debut: premier lment.
+ * \param _fin: dernier lment (exactement), ou borne exclue si `_inclureFin` est faux.
+ * \param _nombre: nombre d'lments.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \param _inclureFin: si vrai (par dfaut), le dernier lment vaut `_fin`.
+ * \return Le Vecteur cr.
+ */
+Vecteur Vecteur::espaceLineaire(const double _debut, const double _fin, const size_t _nombre, const PolitiqueExecution & _politique,
+                                const bool _inclureFin){
+    return Vecteur(ExpressionIntervalle::espaceLineaire(_debut, _fin, _nombre, _inclureFin), _politique);
+}
+
+/** \brief Constructeur d'analyse: lit un Vecteur crit dans le format de `toString()` (`[a\tb\tc]`, voir TexteVecteur.h)  partir d'un flux,
+ * par exemple `ifstream fichier("v.txt"); Vecteur v(fichier);` ou `istringstream texte(autre.toString()); Vecteur copie(texte);`. Le texte est lu
+ * par morceaux et converti avec `from_chars`; la lecture s'arrte juste aprs le crochet fermant. Un texte mal form lance une erreur.
+ * \param _entree: flux contenant le texte.
+ * \param _ressource: ressource mmoire o allouer les lments (par dfaut, nullptr: ressource courante du fil, voir MemoireVecteur.h).
+ */
+Vecteur::Vecteur(istream & _entree, pmr::memory_resource * _ressource)
+    : vecteurInterne(_ressource != nullptr ? _ressource : PorteeMemoire::ressourceCourante())
+{
+    INSTRUMENTER_VECTEUR(CONSTRUCTEUR_ANALYSE, 0, 0, 0);
+    TexteVecteur::analyser(_entree, vecteurInterne);
     dimension = vecteurInterne.size();
+    COMPLETER_INSTRUMENTATION_VECTEUR(dimension, 1, dimension * sizeof(double));
 }
 
 /** \brief Oprateur d'assignation. Permet soit de dclarer un nouveau Vecteur comme `Vecteur v2 = v` o `v` est un Vecteur dj dfini, soit d'craser
@@ -67,81 +171,61 @@ Vecteur::Vecteur(const double _start, const double _stop, const double _step){
  */
 Vecteur & Vecteur::operator=(const Vecteur & _autre)
 {
+    INSTRUMENTER_VECTEUR(ASSIGNATION_COPIE, _autre.dimension, vecteurInterne.capacity() < _autre.dimension ? 1 : 0, _autre.dimension * sizeof(double));
     if (this == & _autre){
         return *this;
     }
-    dimension = _autre.dimension;
+    // La copie peut lancer bad_alloc (par exemple une ressource mmoire borne): la dimension ne change qu'une fois les lments copis.
     vecteurInterne = _autre.vecteurInterne;
+    dimension = _autre.dimension;
     return *this;
 }
 
-/** \brief Oprateur [<arguments>] qui permet d'indexer le Vecteur courant (un peu comme en Python avec les listes, etc.). En plus de donner la valeur
- *  un certain index, on peut aussi modifier cette valeur (d'o le retour par rfrence).  noter que l'index est un entier non sign et qu'il doit tre
- * strictement plus petit que la dimension du vecteur (sinon, out of range).
- * \param _index: de type size_t, index de l'lment qu'on veut accder. Doit tre strictement plus petit que la dimension du vecteur, sinon une erreur
- * est lance.
- * \return la rfrence vers la valeur contenue  l'index donn. Ainsi, on peut non seulement accder  cette valeur, mais aussi la modifier.
+/** \brief Oprateur d'assignation par dplacement (move). Comme le constructeur par dplacement, on rcupre la mmoire de l'autre Vecteur au lieu
+ * de la copier. Ainsi, `v = a.cross(b)` ne copie pas le rsultat. Exception: si les deux Vecteurs n'utilisent pas la mme ressource mmoire (voir
+ * MemoireVecteur.h), le Vecteur courant garde la sienne et les lments y sont copis.
+ * \param _autre: Vecteur du ct droit du symbole d'assignation, dont on prend la mmoire. Il devient vide (dimension 0).
+ * \return *this, le pointeur de l'objet courant drfrenc.
  */
-double & Vecteur::operator[](const size_t _index){
-    if (_index >= dimension){
-        throw runtime_error("L'index est en-dehors du vecteur.");
-    }
-    return vecteurInterne[_index];
-}
-
-/** \brief Oprateur `+` pour additionner deux Vecteurs ensemble. Pas trop compliqu. On s'assure que les deux Vecteurs soient de mme dimension.
- * On se cre un Vecteur de retour (ici, `retour`) de mme dimension que ceux impliqus dans l'addition.
- * \param _autre: Vecteur qu'on veut additionner  l'objet courant. Doit tre de mme dimension que celui courant.
- * \return Le Vecteur contenant l'addition des deux autres. On ne retourne pas par rfrence, car comme l'objet est cr dans la fonction, ds qu'on
- * sort du scope (i.e. de la fonction), ce Vecteur n'existera plus ( cause du garbage collector). Il faut donc en retourner une copie (pas de &).
- */
-Vecteur Vecteur::operator+(const Vecteur & _autre){
-    if (dimension != _autre.dimension){
-        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
-    }
-    Vecteur retour(dimension, 0);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = vecteurInterne[i] + _autre.vecteurInterne[i];
+Vecteur & Vecteur::operator=(Vecteur && _autre)
+{
+    INSTRUMENTER_VECTEUR(ASSIGNATION_DEPLACEMENT, _autre.dimension, 0, getRessourceMemoire() == _autre.getRessourceMemoire() ? 0 : _autre.dimension * sizeof(double));
+    if (this == & _autre){
+        return *this;
     }
-    return retour;
+    vecteurInterne = move(_autre.vecteurInterne);
+    dimension = _autre.dimension;
+    _autre.vecteurInterne.clear();
+    _autre.dimension = 0;
+    return *this;
 }
 
 /** \brief Oprateur `+=`, quivalent  `courant = courant + autre` o `courant` et `autre` sont deux Vecteurs dj dfinis.
- * On se cre un Vecteur temporaire qui contient l'addition `(*this) + _autre` et ensuite on affecte  l'objet courant ce Vecteur temporaire.
- * On retourne ensuite (en rfrence) le pointeur de l'objet courant drfrenc.
- * \param _autre: Vecteur  additionner  l'objet courant. On se base sur l'implmentation de l'oprateur `+` pour ne pas dupliquer du code
- * inutilement. Ainsi, les deux Vecteurs doivent tre de mme dimension.
+ * On additionne directement chaque lment de `_autre` dans la mmoire de l'objet courant: aucun Vecteur temporaire, aucune allocation et un seul
+ * passage sur les lments. On retourne ensuite (en rfrence) le pointeur de l'objet courant drfrenc.
+ * \param _autre: Vecteur  additionner  l'objet courant. Les deux Vecteurs doivent tre de mme dimension.
  * \return (*this), le pointeur de l'objet courant drfrenc (tout a en rfrence, car encore on ne veut pas dupliquer l'objet courant)!
  */
 Vecteur & Vecteur::operator+=(const Vecteur & _autre){
-    Vecteur retour = (*this) + _autre;
-    (*this) = retour;
-    return (*this);
-}
-
-/** \brief Oprateur `-` pour soustraire deux Vecteurs. Trs semblable  l'oprateur `+`, sauf qu'on soustrait au lieu d'additionner les valeurs internes.
- * \param _autre: Vecteur qu'on veut soustraire  celui courant. Doivent tre de mme dimension.
- * \return Un nouveau Vecteur (retour par copie parce que sinon on perd le Vecteur dclar  l'interne).
- */
-Vecteur Vecteur::operator-(const Vecteur & _autre){
+    INSTRUMENTER_VECTEUR(AJOUTER, dimension, 0, 0);
     if (dimension != _autre.dimension){
         throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
     }
-    Vecteur retour(dimension, 0);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = vecteurInterne[i] - _autre.vecteurInterne[i];
-    }
-    return retour;
+    Noyaux::ajouter(vecteurInterne.data(), _autre.vecteurInterne.data(), dimension);
+    return (*this);
 }
 
 /** \brief Oprateur `-=`, quivalent  `courant = courant - autre` o `courant` et `autre` sont deux Vecteurs dj dfinis. Logique identique  celle de
- * `+=`, sauf pour la soustraction au lieu de l'addition.
+ * `+=` (en place, sans allocation), sauf pour la soustraction au lieu de l'addition.
  * \param _autre: Vecteur  soustraire au Vecteur courant. Doivent tre de mme dimension.
  * \return (*this), le pointeur de l'objet courant drfrenc (tout a en rfrence, car encore on ne veut pas dupliquer l'objet courant)!
  */
 Vecteur & Vecteur::operator-=(const Vecteur & _autre){
-    Vecteur retour = (*this) - _autre;
-    (*this) = retour;
+    INSTRUMENTER_VECTEUR(SOUSTRAIRE, dimension, 0, 0);
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    Noyaux::soustraire(vecteurInterne.data(), _autre.vecteurInterne.data(), dimension);
     return (*this);
 }
 
@@ -150,113 +234,95 @@ Vecteur & Vecteur::operator-=(const Vecteur & _autre){
  * \param _autre: Vecteur avec lequel faire le produit scalaire. Doit tre de dimension gale  l'objet courant.
  * \return le produit scalaire entre les deux Vecteurs (un double).
  */
-double Vecteur::operator*(const Vecteur & _autre){
+double Vecteur::operator*(const Vecteur & _autre) const {
     return dot(_autre);
 }
 
+/** \brief Vue (sans copie) sur tous les lments du Vecteur courant, par exemple pour la passer  une fonction qui accepte aussi d'autres mmoires.
+ * La vue devient invalide si le Vecteur courant est dtruit ou change de dimension.
+ * \return Une vue modifiable, de pas 1.
+ */
+VecteurVue Vecteur::vue(){
+    return VecteurVue(vecteurInterne.data(), dimension);
+}
+
+/** \brief Vue en lecture seule sur tous les lments du Vecteur courant.
+ * \return Une vue en lecture seule, de pas 1.
+ */
+VecteurVueConst Vecteur::vue() const {
+    return VecteurVueConst(vecteurInterne.data(), dimension);
+}
+
+/** \brief Vue (sans copie) sur une partie des lments du Vecteur courant: les index `_debut`, `_debut + _pas`, ... plus petits que `_fin`.
+ * Par exemple, `v.tranche(0, 100) *= 2.0;` double les 100 premiers lments et `v.tranche(1, n, 2).somme()` additionne les lments d'index impair.
+ * \param _debut: index du premier lment.
+ * \param _fin: index de fin (exclu). Doit tre au plus la dimension du Vecteur.
+ * \param _pas: pas entre deux lments de la vue (au moins 1).
+ * \return Une vue modifiable.
+ */
+VecteurVue Vecteur::tranche(const size_t _debut, const size_t _fin, const size_t _pas){
+    return vue().tranche(_debut, _fin, _pas);
+}
+
+/** \brief Variante en lecture seule de `tranche(...)`.
+ */
+VecteurVueConst Vecteur::tranche(const size_t _debut, const size_t _fin, const size_t _pas) const {
+    return vue().tranche(_debut, _fin, _pas);
+}
+
 /** \brief Mthode qui calcule le produit scalaire entre deux Vecteurs de mme dimension.
- * L'algorithme est simple: on itre sur les lments des deux vecteurs et on somme le produit des lments.
+ * L'algorithme est simple: on itre sur les lments des deux vecteurs et on somme le produit des lments. Le calcul est dlgu au noyau SIMD
+ * `Noyaux::produitScalaire` (plusieurs sommes partielles en parallle; voir Noyaux.h pour les garanties de prcision).
  * \param _autre: Vecteur avec lequel faire le produit scalaire. Doit tre de mme dimension que l'objet courant.
  * \return le produit scalaire entre les deux Vecteurs (un double).
  */
-double Vecteur::dot(const Vecteur & _autre){
+double Vecteur::dot(const Vecteur & _autre) const {
+    INSTRUMENTER_VECTEUR(DOT, dimension, 0, 0);
     if (dimension != _autre.dimension){
         throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
     }
-    double retour = 0;
-    for (size_t i = 0; i < dimension; i++){
-        retour += vecteurInterne[i] * _autre.vecteurInterne[i];
-    }
-    return retour;
-}
-
-/** \brief Oprateur `+`, mais cette fois-ci dfini pour l'addition avec un scalaire.
- * \param _autre: double qu'on veut additionner au Vecteur courant. Peut tre aussi d'un autre type comme int (double englobe int).
- * \return Le Vecteur contenant l'addition du Vecteur courant er du scalaire (retour par copie).
- */
-Vecteur Vecteur::operator+(const double _autre){
-    Vecteur retour(dimension, 0);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = vecteurInterne[i] + _autre;
-    }
-    return retour;
+    return Noyaux::produitScalaire(vecteurInterne.data(), _autre.vecteurInterne.data(), dimension);
 }
 
 /** \brief Oprateur `+=`, mais version scalaire.
- * Utilise  l'interne l'oprateur `+` (version scalaire bien sr!) pour faire le calcul et ne pas dupliquer de code inutilement.
+ * Modifie directement les lments du Vecteur courant, sans Vecteur temporaire ni allocation.
  * \param _autre: double qu'on veut additionner au Vecteur courant. Peut tre aussi d'un autre type comme int.
  * \return Le Vecteur courant modifi par l'addition du scalaire.
  */
 Vecteur & Vecteur::operator+=(const double _autre){
-    Vecteur retour = (*this) + _autre;
-    (*this) = retour;
+    INSTRUMENTER_VECTEUR(AJOUTER_SCALAIRE, dimension, 0, 0);
+    Noyaux::ajouterScalaire(vecteurInterne.data(), _autre, dimension);
     return (*this);
 }
 
-/** \brief Oprateur `+`, mais cette fois-ci dfini pour la soustraction avec un scalaire.
- * \param _autre: double qu'on veut soustraire au Vecteur courant. Peut tre aussi d'un autre type comme int.
- * \return Le Vecteur contenant la soustraction du Vecteur courant et du scalaire (retour par copie).
- */
-Vecteur Vecteur::operator-(const double _autre){
-    Vecteur retour(dimension, 0);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = vecteurInterne[i] - _autre;
-    }
-    return retour;
-}
-
 /** \brief Oprateur `-=`, mais version scalaire.
- * Utilise  l'interne l'oprateur `-` (version scalaire bien sr!) pour faire le calcul et ne pas dupliquer de code inutilement.
+ * Modifie directement les lments du Vecteur courant, sans Vecteur temporaire ni allocation.
  * \param _autre: double qu'on veut soustraire au Vecteur courant. Peut tre aussi d'un autre type comme int.
  * \return Le Vecteur courant modifi par la soustraction du scalaire.
  */
 Vecteur & Vecteur::operator-=(const double _autre){
-    Vecteur retour = (*this) - _autre;
-    (*this) = retour;
+    INSTRUMENTER_VECTEUR(SOUSTRAIRE_SCALAIRE, dimension, 0, 0);
+    Noyaux::ajouterScalaire(vecteurInterne.data(), -_autre, dimension);
     return (*this);
 }
 
-/** \brief Oprateur `*`, soit la multiplication du Vecteur courant par un scalaire.
- * \param _autre: double qu'on veut multiplier au Vecteur courant. Peut tre aussi d'un autre type comme int.
- * \return Le Vecteur contenant le Vecteur courant modifi par le produit avec le scalaire.
- */
-Vecteur Vecteur::operator*(const double _autre){
-    Vecteur retour(dimension, 0);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = vecteurInterne[i] * _autre;
-    }
-    return retour;
-}
-
-/** \brief Oprateur `*=`.
+/** \brief Oprateur `*=`. Multiplie directement les lments du Vecteur courant, sans Vecteur temporaire ni allocation.
  * \param _autre: double qu'on veut multiplier au Vecteur courant. Peut tre aussi d'un autre type comme int.
  * \return Le Vecteur courant modifi par le produit avec le scalaire.
  */
 Vecteur & Vecteur::operator*=(const double _autre){
-    Vecteur retour = (*this) * _autre;
-    (*this) = retour;
+    INSTRUMENTER_VECTEUR(MULTIPLIER_SCALAIRE, dimension, 0, 0);
+    Noyaux::multiplierScalaire(vecteurInterne.data(), _autre, dimension);
     return (*this);
 }
 
-/** \brief Oprateur `/`, soit la division du Vecteur courant par un scalaire.
- * \param _autre: double qu'on veut diviser au Vecteur courant. Peut tre aussi d'un autre type comme int.
- * \return Le Vecteur contenant le Vecteur courant modifi par la division avec le scalaire.
- */
-Vecteur Vecteur::operator/(const double _autre){
-    Vecteur retour(dimension, 0);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = vecteurInterne[i] / _autre;
-    }
-    return retour;
-}
-
-/** \brief Oprateur `/=`.
+/** \brief Oprateur `/=`. Divise directement les lments du Vecteur courant, sans Vecteur temporaire ni allocation.
  * \param _autre: double qu'on veut diviser au Vecteur courant. Peut tre aussi d'un autre type comme int.
  * \return Le Vecteur courant modifi par la division avec le scalaire.
  */
 Vecteur & Vecteur::operator/=(const double _autre){
-    Vecteur retour = (*this) / _autre;
-    (*this) = retour;
+    INSTRUMENTER_VECTEUR(DIVISER_SCALAIRE, dimension, 0, 0);
+    Noyaux::diviserScalaire(vecteurInterne.data(), _autre, dimension);
     return (*this);
 }
 
@@ -268,7 +334,8 @@ Vecteur & Vecteur::operator/=(const double _autre){
  * \return Vecteur (copie) contenant les lments du produit vectoriel.
  *
  */
-Vecteur Vecteur::cross(const Vecteur & _autre){
+Vecteur Vecteur::cross(const Vecteur & _autre) const {
+    INSTRUMENTER_VECTEUR(CROSS, 3, 1, 3 * sizeof(double));
     if (dimension != 3 || _autre.dimension != 3){
         throw runtime_error("Le produit vectoriel est dfini seulement pour les vecteurs 3D.");
     }
@@ -282,76 +349,393 @@ Vecteur Vecteur::cross(const Vecteur & _autre){
 
 
 /** \brief Mthode permettant de calculer la puissance des lments du Vecteur courant. Chaque lment est valu  une certaine puissance.
+ * Dlgu au noyau `Noyaux::puissance`: les puissances courantes (carr, cube, inverse, racine carre, etc.) sont calcules sans `pow`, et les
+ * autres par un noyau SIMD (voir Noyaux.h pour la prcision et les cas limites). Pour viter la copie, voir `exposantEnPlace(...)`.
  * \param _puissance: double. Puissance  laquelle on veut lever les lments du Vecteur courant.
  * \return Un Vecteur (copie) dont les lments sont ceux du Vecteur courant levs  une certaine puissance.
  */
-Vecteur Vecteur::exposant(const double _puissance){
-    Vecteur retour(*this);
-    for (size_t i = 0; i < dimension; i++){
-        retour.vecteurInterne[i] = pow(vecteurInterne[i], _puissance);
-    }
+Vecteur Vecteur::exposant(const double _puissance) const {
+    INSTRUMENTER_VECTEUR(EXPOSANT, dimension, 1, dimension * sizeof(double));
+    Vecteur retour(dimension, 0);
+    Noyaux::puissance(retour.vecteurInterne.data(), vecteurInterne.data(), _puissance, dimension);
     return retour;
 }
 
-/** \brief Mthode permettant de calculer la somme des lments d'un Vecteur.
+/** \brief Variante en place de `exposant(...)`: les lments du Vecteur courant sont remplacs par leur puissance, sans allocation ni copie.
+ * \param _puissance: double. Puissance  laquelle on veut lever les lments du Vecteur courant.
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::exposantEnPlace(const double _puissance){
+    INSTRUMENTER_VECTEUR(EXPOSANT_EN_PLACE, dimension, 0, 0);
+    Noyaux::puissance(vecteurInterne.data(), vecteurInterne.data(), _puissance, dimension);
+    return *this;
+}
+
+/** \brief Mthode permettant de calculer la somme des lments d'un Vecteur. Dlgu au noyau SIMD `Noyaux::somme`.
  * \return La somme des lment du Vecteur courant (double).
  */
-double Vecteur::somme(){
-    double retour = 0;
-    for (size_t i = 0; i < dimension; i++){
-        retour += vecteurInterne[i];
+double Vecteur::somme() const {
+    INSTRUMENTER_VECTEUR(SOMME, dimension, 0, 0);
+    return Noyaux::somme(vecteurInterne.data(), dimension);
+}
+
+/** \brief Mthode permettant de calculer le produit des lments d'un Vecteur. Dlgu au noyau SIMD `Noyaux::produit`.
+ * \return Le produit des lments du Vecteur courant (double)
+ */
+double Vecteur::prod() const {
+    INSTRUMENTER_VECTEUR(PROD, dimension, 0, 0);
+    return Noyaux::produit(vecteurInterne.data(), dimension);
+}
+
+/** \brief Mthode permettant de calculer la norme du Vecteur courant (racine de la somme des carrs, noyau SIMD `Noyaux::sommeCarres`).
+ * \return La norme du Vecteur courant (double).
+ *
+ */
+double Vecteur::norme() const {
+    INSTRUMENTER_VECTEUR(NORME, dimension, 0, 0);
+    return sqrt(Noyaux::sommeCarres(vecteurInterne.data(), dimension));
+}
+
+/** \brief Mise  jour `y = a * x + y` (axpy de BLAS), o y est le Vecteur courant: quivalent  `courant += x * a`, mais chaque lment est calcul
+ * par une seule FMA (un seul arrondi au lieu de deux, donc un rsultat parfois plus prcis d'un ulp), en un seul passage et sans allocation.
+ * \param _a: facteur de `_x`.
+ * \param _x: Vecteur  ajouter. Doit tre de mme dimension que l'objet courant (peut tre l'objet courant lui-mme).
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::axpy(const double _a, const Vecteur & _x){
+    INSTRUMENTER_VECTEUR(AXPY, dimension, 0, 0);
+    if (dimension != _x.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    Noyaux::axpy(vecteurInterne.data(), _a, _x.vecteurInterne.data(), dimension);
+    return (*this);
+}
+
+/** \brief Mise  jour `y = a * x + b * y` (axpby), o y est le Vecteur courant, par exemple pour une moyenne mobile
+ * (`moyenne.axpby(alpha, x, 1 - alpha)`). Un seul passage et aucune allocation, contre deux passages pour `courant *= b; courant += x * a;`.
+ * \param _a: facteur de `_x`.
+ * \param _x: Vecteur  ajouter. Doit tre de mme dimension que l'objet courant.
+ * \param _b: facteur de l'objet courant.
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::axpby(const double _a, const Vecteur & _x, const double _b){
+    INSTRUMENTER_VECTEUR(AXPBY, dimension, 0, 0);
+    if (dimension != _x.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
     }
+    Noyaux::axpby(vecteurInterne.data(), _a, _x.vecteurInterne.data(), _b, dimension);
+    return (*this);
+}
+
+/** \brief Multiplie le Vecteur courant par un scalaire (scal de BLAS). Mme chose que `*=`; le nom est l pour complter `axpy` et `axpby`.
+ * \param _a: facteur.
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::scal(const double _a){
+    return (*this) *= _a;
+}
+
+/** \brief Divise le Vecteur courant par sa norme, en place: mme rsultat que `v = v / v.norme();`, mais sans Vecteur temporaire.
+ * \return La norme du Vecteur avant la normalisation (souvent utile aussi, et elle est dj calcule).
+ */
+double Vecteur::normaliser(){
+    INSTRUMENTER_VECTEUR(NORMALISER, dimension, 0, 0);
+    const double normeCourante = sqrt(Noyaux::sommeCarres(vecteurInterne.data(), dimension));
+    if (normeCourante == 0){
+        throw runtime_error("Impossible de normaliser un vecteur nul.");
+    }
+    Noyaux::diviserScalaire(vecteurInterne.data(), normeCourante, dimension);
+    return normeCourante;
+}
+
+/** \brief Produit scalaire et normes des deux Vecteurs en un seul passage sur la mmoire, par exemple pour une similarit cosinus:
+ * `double na, nb; double cosinus = a.dotEtNormes(b, na, nb) / (na * nb);`, au lieu de trois passages avec `dot` et deux `norme`.
+ * Les rsultats peuvent diffrer de ceux de `dot` et `norme` dans les derniers bits (FMA et ordre des additions diffrents).
+ * \param _autre: Vecteur avec lequel faire le produit scalaire. Doit tre de mme dimension que l'objet courant.
+ * \param _normeCourant: (sortie) norme du Vecteur courant.
+ * \param _normeAutre: (sortie) norme de `_autre`.
+ * \return le produit scalaire entre les deux Vecteurs (un double).
+ */
+double Vecteur::dotEtNormes(const Vecteur & _autre, double & _normeCourant, double & _normeAutre) const {
+    INSTRUMENTER_VECTEUR(DOT_ET_NORMES, dimension, 0, 0);
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+    }
+    double carresCourant, carresAutre;
+    const double retour = Noyaux::produitScalaireEtSommesCarres(vecteurInterne.data(), _autre.vecteurInterne.data(), dimension, carresCourant,
+                                                                carresAutre);
+    _normeCourant = sqrt(carresCourant);
+    _normeAutre = sqrt(carresAutre);
     return retour;
 }
 
-/** \brief Mthode permettant de calculer le produit des lments d'un Vecteur.
- * \return Le produit des lments du Vecteur courant (double)
+/** \brief Distance euclidienne entre deux Vecteurs, ||courant - autre||, sans construire le Vecteur `courant - autre` (aucune allocation, un seul
+ * passage). quivalent  `Vecteur(a - b).norme()`, aux derniers bits prs.
+ * \param _autre: Vecteur dont on veut la distance. Doit tre de mme dimension que l'objet courant.
+ * \return la distance (un double).
+ */
+double Vecteur::distance(const Vecteur & _autre) const {
+    INSTRUMENTER_VECTEUR(DISTANCE, dimension, 0, 0);
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour la distance.");
+    }
+    return sqrt(Noyaux::distanceCarree(vecteurInterne.data(), _autre.vecteurInterne.data(), dimension));
+}
+
+namespace
+{
+    double additionner(const double _a, const double _b){
+        return _a + _b;
+    }
+
+    double multiplier(const double _a, const double _b){
+        return _a * _b;
+    }
+}
+
+/** \brief Variante parallle de `dot(...)`. Au-del du seuil de la politique, chaque fil calcule le produit scalaire d'un morceau des deux Vecteurs,
+ * puis on additionne les rsultats partiels dans l'ordre des morceaux. Sous le seuil, le rsultat est identique  `dot(_autre)`.
+ * \param _autre: Vecteur avec lequel faire le produit scalaire. Doit tre de mme dimension que l'objet courant.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return le produit scalaire entre les deux Vecteurs (un double).
  */
-double Vecteur::prod(){
-    double retour = 1;
-    for (size_t i = 0; i < dimension; i++){
-        retour *= vecteurInterne[i];
+double Vecteur::dot(const Vecteur & _autre, const PolitiqueExecution & _politique) const {
+    INSTRUMENTER_VECTEUR(DOT, dimension, 0, 0);
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
     }
+    const double * a = vecteurInterne.data();
+    const double * b = _autre.vecteurInterne.data();
+    return Parallele::reduire(dimension, _politique, [a, b](const size_t _debut, const size_t _fin){
+        return Noyaux::produitScalaire(a + _debut, b + _debut, _fin - _debut);
+    }, additionner);
+}
+
+/** \brief Variante parallle de `exposant(...)`: chaque fil lve  la puissance un morceau du Vecteur. Rsultat identique  `exposant(_puissance)`.
+ * \param _puissance: double. Puissance  laquelle on veut lever les lments du Vecteur courant.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return Un Vecteur (copie) dont les lments sont ceux du Vecteur courant levs  une certaine puissance.
+ */
+Vecteur Vecteur::exposant(const double _puissance, const PolitiqueExecution & _politique) const {
+    INSTRUMENTER_VECTEUR(EXPOSANT, dimension, 1, dimension * sizeof(double));
+    Vecteur retour(dimension, 0);
+    const double * source = vecteurInterne.data();
+    double * destination = retour.vecteurInterne.data();
+    Parallele::pourChaqueMorceau(dimension, _politique, [source, destination, _puissance](const size_t _debut, const size_t _fin){
+        Noyaux::puissance(destination + _debut, source + _debut, _puissance, _fin - _debut);
+    });
     return retour;
 }
 
-/** \brief Mthode permettant de calculer la norme du Vecteur courant.
+/** \brief Variante parallle de `exposantEnPlace(...)`. Rsultat identique  `exposantEnPlace(_puissance)`.
+ * \param _puissance: double. Puissance  laquelle on veut lever les lments du Vecteur courant.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::exposantEnPlace(const double _puissance, const PolitiqueExecution & _politique){
+    INSTRUMENTER_VECTEUR(EXPOSANT_EN_PLACE, dimension, 0, 0);
+    double * donnees = vecteurInterne.data();
+    Parallele::pourChaqueMorceau(dimension, _politique, [donnees, _puissance](const size_t _debut, const size_t _fin){
+        Noyaux::puissance(donnees + _debut, donnees + _debut, _puissance, _fin - _debut);
+    });
+    return *this;
+}
+
+/** \brief Variante parallle de `somme()`. Sous le seuil de la politique, le rsultat est identique  `somme()`.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return La somme des lment du Vecteur courant (double).
+ */
+double Vecteur::somme(const PolitiqueExecution & _politique) const {
+    INSTRUMENTER_VECTEUR(SOMME, dimension, 0, 0);
+    const double * a = vecteurInterne.data();
+    return Parallele::reduire(dimension, _politique, [a](const size_t _debut, const size_t _fin){
+        return Noyaux::somme(a + _debut, _fin - _debut);
+    }, additionner);
+}
+
+/** \brief Variante parallle de `prod()`. Sous le seuil de la politique, le rsultat est identique  `prod()`.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return Le produit des lments du Vecteur courant (double).
+ */
+double Vecteur::prod(const PolitiqueExecution & _politique) const {
+    INSTRUMENTER_VECTEUR(PROD, dimension, 0, 0);
+    const double * a = vecteurInterne.data();
+    return Parallele::reduire(dimension, _politique, [a](const size_t _debut, const size_t _fin){
+        return Noyaux::produit(a + _debut, _fin - _debut);
+    }, multiplier);
+}
+
+/** \brief Variante parallle de `norme()`. Sous le seuil de la politique, le rsultat est identique  `norme()`.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return La norme du Vecteur courant (double).
+ */
+double Vecteur::norme(const PolitiqueExecution & _politique) const {
+    INSTRUMENTER_VECTEUR(NORME, dimension, 0, 0);
+    const double * a = vecteurInterne.data();
+    return sqrt(Parallele::reduire(dimension, _politique, [a](const size_t _debut, const size_t _fin){
+        return Noyaux::sommeCarres(a + _debut, _fin - _debut);
+    }, additionner));
+}
+
+/** \brief Variante parallle de `axpy(...)`: chaque fil met  jour un morceau du Vecteur. Rsultat identique  `axpy(_a, _x)`.
+ * \param _a: facteur de `_x`.
+ * \param _x: Vecteur  ajouter. Doit tre de mme dimension que l'objet courant.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::axpy(const double _a, const Vecteur & _x, const PolitiqueExecution & _politique){
+    INSTRUMENTER_VECTEUR(AXPY, dimension, 0, 0);
+    if (dimension != _x.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    double * y = vecteurInterne.data();
+    const double * x = _x.vecteurInterne.data();
+    Parallele::pourChaqueMorceau(dimension, _politique, [y, x, _a](const size_t _debut, const size_t _fin){
+        Noyaux::axpy(y + _debut, _a, x + _debut, _fin - _debut);
+    });
+    return (*this);
+}
+
+/** \brief Variante parallle de `axpby(...)`. Rsultat identique  `axpby(_a, _x, _b)`.
+ * \param _a: facteur de `_x`.
+ * \param _x: Vecteur  ajouter. Doit tre de mme dimension que l'objet courant.
+ * \param _b: facteur de l'objet courant.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return (*this), le pointeur de l'objet courant drfrenc.
+ */
+Vecteur & Vecteur::axpby(const double _a, const Vecteur & _x, const double _b, const PolitiqueExecution & _politique){
+    INSTRUMENTER_VECTEUR(AXPBY, dimension, 0, 0);
+    if (dimension != _x.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    double * y = vecteurInterne.data();
+    const double * x = _x.vecteurInterne.data();
+    Parallele::pourChaqueMorceau(dimension, _politique, [y, x, _a, _b](const size_t _debut, const size_t _fin){
+        Noyaux::axpby(y + _debut, _a, x + _debut, _b, _fin - _debut);
+    });
+    return (*this);
+}
+
+/** \brief Variante parallle de `distance(...)`. Sous le seuil de la politique, le rsultat est identique  `distance(_autre)`.
+ * \param _autre: Vecteur dont on veut la distance. Doit tre de mme dimension que l'objet courant.
+ * \param _politique: politique d'excution (voir PolitiqueExecution.h).
+ * \return la distance (un double).
+ */
+double Vecteur::distance(const Vecteur & _autre, const PolitiqueExecution & _politique) const {
+    INSTRUMENTER_VECTEUR(DISTANCE, dimension, 0, 0);
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour la distance.");
+    }
+    const double * a = vecteurInterne.data();
+    const double * b = _autre.vecteurInterne.data();
+    return sqrt(Parallele::reduire(dimension, _politique, [a, b](const size_t _debut, const size_t _fin){
+        return Noyaux::distanceCarree(a + _debut, b + _debut, _fin - _debut);
+    }, additionner));
+}
+
+/** \brief Variante de `dot(...)` avec une stratgie de rduction: `Noyaux::PAR_PAIRES` (mme vitesse, erreur en log2(n)) ou `Noyaux::COMPENSEE`
+ * (rsultat presque exact mme quand les termes s'annulent). Avec `Noyaux::RAPIDE`, le rsultat est identique  `dot(_autre)`.
+ * \param _autre: Vecteur avec lequel faire le produit scalaire. Doit tre de mme dimension que l'objet courant.
+ * \param _reduction: stratgie de rduction (voir Noyaux.h pour les bornes d'erreur).
+ * \return le produit scalaire entre les deux Vecteurs (un double).
+ */
+double Vecteur::dot(const Vecteur & _autre, const Noyaux::Reduction _reduction) const {
+    INSTRUMENTER_VECTEUR(DOT, dimension, 0, 0);
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+    }
+    return Noyaux::produitScalaire(vecteurInterne.data(), _autre.vecteurInterne.data(), dimension, _reduction);
+}
+
+/** \brief Variante de `somme()` avec une stratgie de rduction. Avec `Noyaux::RAPIDE`, le rsultat est identique  `somme()`.
+ * \param _reduction: stratgie de rduction (voir Noyaux.h pour les bornes d'erreur).
+ * \return La somme des lment du Vecteur courant (double).
+ */
+double Vecteur::somme(const Noyaux::Reduction _reduction) const {
+    INSTRUMENTER_VECTEUR(SOMME, dimension, 0, 0);
+    return Noyaux::somme(vecteurInterne.data(), dimension, _reduction);
+}
+
+/** \brief Variante de `prod()` sans dpassement intermdiaire. Avec `Noyaux::RAPIDE`, le rsultat est identique  `prod()`; avec les autres
+ * stratgies, les mantisses et les exposants sont multiplis sparment (`Noyaux::produitEchelonne`): `prod()` de {1e200, 1e200, 1e-300} donne
+ * infini, alors que cette variante donne 1e100. Le rsultat n'est infini ou nul que si le produit final l'est.
+ * \param _reduction: stratgie de rduction.
+ * \return Le produit des lments du Vecteur courant (double).
+ */
+double Vecteur::prod(const Noyaux::Reduction _reduction) const {
+    INSTRUMENTER_VECTEUR(PROD, dimension, 0, 0);
+    if (_reduction == Noyaux::RAPIDE){
+        return Noyaux::produit(vecteurInterne.data(), dimension);
+    }
+    int64_t exposant;
+    const double mantisse = Noyaux::produitEchelonne(vecteurInterne.data(), dimension, exposant);
+    // ldexp prend un int: au-del de 4096, le rsultat est de toute faon infini ou nul.
+    return ldexp(mantisse, int(max<int64_t>(-4096, min<int64_t>(4096, exposant))));
+}
+
+/** \brief Logarithme naturel de la valeur absolue du produit des lments, pour les produits qui ne tiennent pas dans un double (par exemple une
+ * vraisemblance, produit de milliers de probabilits). Calcul  partir du produit chelonn (`log(mantisse) + exposant * log(2)`), ce qui est plus
+ * prcis et beaucoup plus rapide que la somme des `log(|x_i|)`.
+ * \param _signe: (sortie, optionnelle) signe du produit: 1, -1, ou 0 si un lment est nul (le logarithme vaut alors -infini).
+ * \return log(|prod()|) (double).
+ */
+double Vecteur::logProd(int * _signe) const {
+    INSTRUMENTER_VECTEUR(LOG_PROD, dimension, 0, 0);
+    int64_t exposant;
+    const double mantisse = Noyaux::produitEchelonne(vecteurInterne.data(), dimension, exposant);
+    if (_signe != nullptr){
+        *_signe = mantisse > 0 ? 1 : (mantisse < 0 ? -1 : 0);
+    }
+    if (mantisse == 0){
+        return -INFINITY;
+    }
+    return log(fabs(mantisse)) + double(exposant) * log(2.0);
+}
+
+/** \brief Variante de `norme()` avec une stratgie de rduction. Avec `Noyaux::RAPIDE`, le rsultat est identique  `norme()`.
+ * \param _reduction: stratgie de rduction (voir Noyaux.h pour les bornes d'erreur).
  * \return La norme du Vecteur courant (double).
- *
  */
-double Vecteur::norme(){
-    return sqrt(dot(*this));
+double Vecteur::norme(const Noyaux::Reduction _reduction) const {
+    INSTRUMENTER_VECTEUR(NORME, dimension, 0, 0);
+    return sqrt(Noyaux::sommeCarres(vecteurInterne.data(), dimension, _reduction));
+}
+
+/** \brief Ressource mmoire dans laquelle sont allous les lments du Vecteur courant (voir MemoireVecteur.h).
+ * \return Un pointeur vers la ressource (jamais nullptr).
+ */
+pmr::memory_resource * Vecteur::getRessourceMemoire() const {
+    return vecteurInterne.get_allocator().resource();
 }
 
 /** \brief Mthode permettant d'accder  l'attribut priv `dimension`.
  * \return La dimension du Vecteur courant.
  */
-size_t Vecteur::getDimension(){
+size_t Vecteur::getDimension() const {
     return dimension;
 }
 
 /** \brief Mthode permttant d'obtenir une reprsentation en chane de caractres du Vecteur courant.
- * On se base sur un stream `ostringstream` qui permet d'ajouter des caractres ou des strings avec l'oprateur `<<`. On peut ensuite accder  son
- * contenu avec la mthode `str()`.
+ * Chaque lment est crit avec `to_chars` (la plus courte reprsentation qui redonne exactement le mme double) dans un petit tampon sur la pile,
+ * ajout  la chane chaque fois qu'il est plein, sans passer par un `ostringstream`. La chane ne rserve donc pas la taille maximale du texte
+ * (environ 25 caractres par lment, souvent bien plus que le texte rel): sa capacit suit sa taille.
  * \return Une reprsentation en chane de caractre du Vecteur courant.
  */
-string Vecteur::toString(){
-    ostringstream streamInfo;
-    string separateur = "\t";
-    streamInfo << "[";
-    for (size_t i = 0; i < dimension; i++){
-        streamInfo << vecteurInterne[i];
-        if (i != dimension - 1){
-            streamInfo << separateur;
-        }
-    }
-    streamInfo << "]";
-    return streamInfo.str();
+string Vecteur::toString() const {
+    INSTRUMENTER_VECTEUR(TEXTE, dimension, 1, 0);
+    string retour;
+    char tampon[4096];
+    TexteVecteur::formater(vue(), tampon, sizeof(tampon), [&retour](const char * _debut, const size_t _taille){
+        retour.append(_debut, _taille);
+    });
+    return retour;
 }
 
-/** \brief Mthode permettant d'afficher en console la reprsentation en chane de caractres du Vecteur courant.
+/** \brief Mthode permettant d'afficher en console la reprsentation en chane de caractres du Vecteur courant. Le texte est crit par morceaux,
+ * sans construire la chane complte.
  * \return void, rien.
  */
-void Vecteur::afficher(){
-    cout << this->toString() << endl;
+void Vecteur::afficher() const {
+    TexteVecteur::ecrire(vue(), cout);
+    cout << endl;
 }
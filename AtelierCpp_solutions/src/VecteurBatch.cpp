@@ -0,0 +1,424 @@
+#include "VecteurBatch.h"
+#include "Noyaux.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+const size_t VecteurBatch::ALIGNEMENT;
+
+/** \brief Constructeur de la classe VecteurBatch. Cre `_nombreLignes` vecteurs de dimension `_dimension`, tous remplis avec `_valeurInitiale`.
+ * \param _nombreLignes: nombre de vecteurs dans le lot.
+ * \param _dimension: dimension commune des vecteurs. Si le bloc de mmoire ne peut pas tre adress, une `length_error` est lance.
+ * \param _valeurInitiale: valeur donne  chaque lment (les lments de remplissage, eux, valent toujours 0).
+ */
+VecteurBatch::VecteurBatch(const size_t _nombreLignes, const size_t _dimension, const double _valeurInitiale)
+    : donnees(nullptr), nombreLignes(0), dimension(0), pas(0)
+{
+    allouer(_nombreLignes, _dimension);
+    for (size_t i = 0; i < nombreLignes; i++){
+        double * courante = ligne(i);
+        for (size_t j = 0; j < dimension; j++){
+            courante[j] = _valeurInitiale;
+        }
+    }
+}
+
+/** \brief Variante du constructeur: copie une collection de Vecteurs (tous de mme dimension) dans un lot contigu.
+ * \param _vecteurs: Vecteurs  copier. Un lot vide donne 0 ligne de dimension 0.
+ */
+VecteurBatch::VecteurBatch(const vector<Vecteur> & _vecteurs)
+    : donnees(nullptr), nombreLignes(0), dimension(0), pas(0)
+{
+    allouer(_vecteurs.size(), _vecteurs.empty() ? 0 : _vecteurs[0].getDimension());
+    for (size_t i = 0; i < nombreLignes; i++){
+        definir(i, _vecteurs[i]);
+    }
+}
+
+/** \brief Constructeur copie. Copie tout le bloc de mmoire d'un coup (remplissage compris).
+ * \param _autre: lot qu'on copie.
+ */
+VecteurBatch::VecteurBatch(const VecteurBatch & _autre)
+    : donnees(nullptr), nombreLignes(0), dimension(0), pas(0)
+{
+    allouer(_autre.nombreLignes, _autre.dimension);
+    if (donnees != nullptr){
+        memcpy(donnees, _autre.donnees, nombreLignes * pas * sizeof(double));
+    }
+}
+
+/** \brief Constructeur par dplacement: on rcupre le bloc de mmoire de l'autre lot, qui devient vide.
+ * \param _autre: lot dont on prend la mmoire.
+ */
+VecteurBatch::VecteurBatch(VecteurBatch && _autre) noexcept
+    : donnees(_autre.donnees), nombreLignes(_autre.nombreLignes), dimension(_autre.dimension), pas(_autre.pas)
+{
+    _autre.donnees = nullptr;
+    _autre.nombreLignes = 0;
+    _autre.dimension = 0;
+    _autre.pas = 0;
+}
+
+/** \brief Destructeur. Libre le bloc de mmoire align.
+ */
+VecteurBatch::~VecteurBatch()
+{
+    liberer();
+}
+
+/** \brief Oprateur d'assignation (copie). Si la forme change et que l'allocation choue, le lot courant reste inchang.
+ * \param _autre: lot du ct droit du symbole d'assignation.
+ * \return *this, le pointeur de l'objet courant drfrenc.
+ */
+VecteurBatch & VecteurBatch::operator=(const VecteurBatch & _autre){
+    if (this == & _autre){
+        return *this;
+    }
+    if (nombreLignes != _autre.nombreLignes || dimension != _autre.dimension){
+        allouer(_autre.nombreLignes, _autre.dimension);
+    }
+    if (donnees != nullptr){
+        memcpy(donnees, _autre.donnees, nombreLignes * pas * sizeof(double));
+    }
+    return *this;
+}
+
+/** \brief Oprateur d'assignation par dplacement.
+ * \param _autre: lot dont on prend la mmoire. Il devient vide.
+ * \return *this, le pointeur de l'objet courant drfrenc.
+ */
+VecteurBatch & VecteurBatch::operator=(VecteurBatch && _autre) noexcept {
+    if (this == & _autre){
+        return *this;
+    }
+    liberer();
+    donnees = _autre.donnees;
+    nombreLignes = _autre.nombreLignes;
+    dimension = _autre.dimension;
+    pas = _autre.pas;
+    _autre.donnees = nullptr;
+    _autre.nombreLignes = 0;
+    _autre.dimension = 0;
+    _autre.pas = 0;
+    return *this;
+}
+
+/** \brief Pointeur vers le premier lment d'une ligne. Les `getDimension()` lments de la ligne se suivent en mmoire.
+ * \param _ligne: index de la ligne. Doit tre strictement plus petit que le nombre de lignes.
+ * \return Le pointeur vers la ligne.
+ */
+double * VecteurBatch::ligne(const size_t _ligne){
+    if (_ligne >= nombreLignes){
+        throw runtime_error("L'index de ligne est en-dehors du lot.");
+    }
+    return donnees + _ligne * pas;
+}
+
+const double * VecteurBatch::ligne(const size_t _ligne) const {
+    if (_ligne >= nombreLignes){
+        throw runtime_error("L'index de ligne est en-dehors du lot.");
+    }
+    return donnees + _ligne * pas;
+}
+
+/** \brief Accs  un lment (ligne, colonne), en lecture et en criture.
+ * \param _ligne: index de la ligne.
+ * \param _colonne: index de l'lment dans la ligne. Doit tre strictement plus petit que la dimension.
+ * \return La rfrence vers l'lment.
+ */
+double & VecteurBatch::operator()(const size_t _ligne, const size_t _colonne){
+    if (_colonne >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return ligne(_ligne)[_colonne];
+}
+
+double VecteurBatch::operator()(const size_t _ligne, const size_t _colonne) const {
+    if (_colonne >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return ligne(_ligne)[_colonne];
+}
+
+/** \brief Copie une ligne dans un nouveau Vecteur.
+ * \param _ligne: index de la ligne.
+ * \return Le Vecteur contenant les valeurs de la ligne.
+ */
+Vecteur VecteurBatch::extraire(const size_t _ligne) const {
+    return Vecteur(vueLigne(_ligne));
+}
+
+/** \brief Vue (sans copie) sur une ligne, utilisable comme un Vecteur dans les calculs (voir VueVecteur.h).
+ * \param _ligne: index de la ligne.
+ * \return La vue sur la ligne (pas de 1).
+ */
+VecteurVue VecteurBatch::vueLigne(const size_t _ligne){
+    return VecteurVue(ligne(_ligne), dimension);
+}
+
+VecteurVueConst VecteurBatch::vueLigne(const size_t _ligne) const {
+    return VecteurVueConst(ligne(_ligne), dimension);
+}
+
+/** \brief Vue (sans copie) sur une colonne: l'lment `_colonne` de chaque ligne. Les lments sont espacs de `getPas()` doubles en mmoire.
+ * \param _colonne: index de la colonne. Doit tre strictement plus petit que la dimension.
+ * \return La vue sur la colonne (de dimension `getNombreLignes()`).
+ */
+VecteurVue VecteurBatch::vueColonne(const size_t _colonne){
+    if (_colonne >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return VecteurVue(donnees + _colonne, nombreLignes, pas);
+}
+
+VecteurVueConst VecteurBatch::vueColonne(const size_t _colonne) const {
+    if (_colonne >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return VecteurVueConst(donnees + _colonne, nombreLignes, pas);
+}
+
+/** \brief Remplace les valeurs d'une ligne par celles d'un Vecteur.
+ * \param _ligne: index de la ligne.
+ * \param _valeurs: Vecteur  copier. Doit tre de mme dimension que le lot.
+ */
+void VecteurBatch::definir(const size_t _ligne, const Vecteur & _valeurs){
+    verifierDimension(_valeurs);
+    double * destination = ligne(_ligne);
+    for (size_t j = 0; j < dimension; j++){
+        destination[j] = _valeurs.evaluer(j);
+    }
+}
+
+/** \brief Produit scalaire d'une requte avec chacune des lignes du lot, en un seul appel. La requte reste dans la cache pendant qu'on parcourt les
+ * lignes, qui sont lues squentiellement en mmoire.
+ * \param _requete: Vecteur de mme dimension que le lot.
+ * \param _politique: politique d'excution (les lignes sont rparties entre les fils).
+ * \return Un Vecteur de dimension `getNombreLignes()`, dont l'lment `i` est le produit scalaire de la requte avec la ligne `i`.
+ */
+Vecteur VecteurBatch::dot(const Vecteur & _requete, const PolitiqueExecution & _politique) const {
+    verifierDimension(_requete);
+    Vecteur retour(nombreLignes, 0.0);
+    const double * requete = _requete.data();
+    double * resultats = retour.data();
+    Parallele::pourChaqueMorceau(nombreLignes, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t i = _debut; i < _fin; i++){
+            resultats[i] = Noyaux::produitScalaire(donnees + i * pas, requete, dimension);
+        }
+    }, dimension);
+    return retour;
+}
+
+/** \brief Norme de chacune des lignes du lot.
+ * \param _politique: politique d'excution (les lignes sont rparties entre les fils).
+ * \return Un Vecteur de dimension `getNombreLignes()` contenant la norme de chaque ligne.
+ */
+Vecteur VecteurBatch::normes(const PolitiqueExecution & _politique) const {
+    Vecteur retour(nombreLignes, 0.0);
+    double * resultats = retour.data();
+    Parallele::pourChaqueMorceau(nombreLignes, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t i = _debut; i < _fin; i++){
+            resultats[i] = sqrt(Noyaux::sommeCarres(donnees + i * pas, dimension));
+        }
+    }, dimension);
+    return retour;
+}
+
+/** \brief Matrice des produits scalaires entre chaque ligne du lot courant et chaque ligne d'un autre lot (matrice de Gram si `_autre` est le lot
+ * courant). Le calcul est fait par tuiles: on prend un bloc de lignes de chaque ct, assez petit pour que les deux blocs tiennent ensemble dans la
+ * cache L2, et on calcule tous les produits scalaires entre eux avant de passer au bloc suivant. Chaque ligne est ainsi relue depuis la cache
+ * plutt que depuis la mmoire principale.
+ * \param _autre: lot de mme dimension.
+ * \param _politique: politique d'excution (les tuiles de lignes du lot courant sont rparties entre les fils).
+ * \return Un lot de `getNombreLignes()` lignes de dimension `_autre.getNombreLignes()`: l'lment (i, j) est le produit scalaire des lignes i et j.
+ */
+VecteurBatch VecteurBatch::produitsScalaires(const VecteurBatch & _autre, const PolitiqueExecution & _politique) const {
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+    }
+    VecteurBatch retour(nombreLignes, _autre.nombreLignes);
+    // Environ 128 Ko de donnes par tuile: deux tuiles tiennent dans une cache L2 typique (256 Ko et plus).
+    const size_t lignesParTuile = pas > 0 && 16384 / pas > 0 ? 16384 / pas : 1;
+    const size_t nombreTuiles = (nombreLignes + lignesParTuile - 1) / lignesParTuile;
+    Parallele::pourChaqueMorceau(nombreTuiles, _politique, [&](const size_t _debut, const size_t _fin){
+        for (size_t tuile = _debut; tuile < _fin; tuile++){
+            const size_t debutI = tuile * lignesParTuile;
+            const size_t finI = debutI + lignesParTuile < nombreLignes ? debutI + lignesParTuile : nombreLignes;
+            for (size_t debutJ = 0; debutJ < _autre.nombreLignes; debutJ += lignesParTuile){
+                const size_t finJ = debutJ + lignesParTuile < _autre.nombreLignes ? debutJ + lignesParTuile : _autre.nombreLignes;
+                for (size_t i = debutI; i < finI; i++){
+                    const double * ligneI = donnees + i * pas;
+                    double * resultat = retour.donnees + i * retour.pas;
+                    for (size_t j = debutJ; j < finJ; j++){
+                        resultat[j] = Noyaux::produitScalaire(ligneI, _autre.donnees + j * _autre.pas, dimension);
+                    }
+                }
+            }
+        }
+    }, lignesParTuile * (_autre.nombreLignes > 0 ? _autre.nombreLignes : 1) * dimension);
+    return retour;
+}
+
+/** \brief Produit vectoriel de chaque ligne du lot avec un mme Vecteur 3D.
+ * \param _autre: Vecteur de dimension 3.
+ * \return Un lot de mme taille, dont la ligne `i` est `ligne(i) x _autre`.
+ */
+VecteurBatch VecteurBatch::cross(const Vecteur & _autre) const {
+    if (dimension != 3 || _autre.getDimension() != 3){
+        throw runtime_error("Le produit vectoriel est dfini seulement pour les vecteurs 3D.");
+    }
+    const double w0 = _autre.evaluer(0);
+    const double w1 = _autre.evaluer(1);
+    const double w2 = _autre.evaluer(2);
+    VecteurBatch retour(nombreLignes, 3);
+    for (size_t i = 0; i < nombreLignes; i++){
+        const double * v = donnees + i * pas;
+        double * r = retour.donnees + i * retour.pas;
+        r[0] = (v[1] * w2) - (v[2] * w1);
+        r[1] = (v[2] * w0) - (v[0] * w2);
+        r[2] = (v[0] * w1) - (v[1] * w0);
+    }
+    return retour;
+}
+
+/** \brief Produit vectoriel ligne par ligne entre deux lots de vecteurs 3D.
+ * \param _autre: lot de mme nombre de lignes, de dimension 3.
+ * \return Un lot dont la ligne `i` est `ligne(i) x _autre.ligne(i)`.
+ */
+VecteurBatch VecteurBatch::cross(const VecteurBatch & _autre) const {
+    if (dimension != 3 || _autre.dimension != 3){
+        throw runtime_error("Le produit vectoriel est dfini seulement pour les vecteurs 3D.");
+    }
+    verifierMemeForme(_autre);
+    VecteurBatch retour(nombreLignes, 3);
+    for (size_t i = 0; i < nombreLignes; i++){
+        const double * v = donnees + i * pas;
+        const double * w = _autre.donnees + i * _autre.pas;
+        double * r = retour.donnees + i * retour.pas;
+        r[0] = (v[1] * w[2]) - (v[2] * w[1]);
+        r[1] = (v[2] * w[0]) - (v[0] * w[2]);
+        r[2] = (v[0] * w[1]) - (v[1] * w[0]);
+    }
+    return retour;
+}
+
+/** \brief Additionne, ligne par ligne, un autre lot de mme forme au lot courant (en place).
+ */
+VecteurBatch & VecteurBatch::operator+=(const VecteurBatch & _autre){
+    verifierMemeForme(_autre);
+    for (size_t i = 0; i < nombreLignes; i++){
+        Noyaux::ajouter(donnees + i * pas, _autre.donnees + i * _autre.pas, dimension);
+    }
+    return *this;
+}
+
+/** \brief Soustrait, ligne par ligne, un autre lot de mme forme au lot courant (en place).
+ */
+VecteurBatch & VecteurBatch::operator-=(const VecteurBatch & _autre){
+    verifierMemeForme(_autre);
+    for (size_t i = 0; i < nombreLignes; i++){
+        Noyaux::soustraire(donnees + i * pas, _autre.donnees + i * _autre.pas, dimension);
+    }
+    return *this;
+}
+
+/** \brief Additionne le mme Vecteur  chacune des lignes du lot (en place).
+ */
+VecteurBatch & VecteurBatch::operator+=(const Vecteur & _autre){
+    verifierDimension(_autre);
+    for (size_t i = 0; i < nombreLignes; i++){
+        Noyaux::ajouter(donnees + i * pas, _autre.data(), dimension);
+    }
+    return *this;
+}
+
+/** \brief Soustrait le mme Vecteur  chacune des lignes du lot (en place).
+ */
+VecteurBatch & VecteurBatch::operator-=(const Vecteur & _autre){
+    verifierDimension(_autre);
+    for (size_t i = 0; i < nombreLignes; i++){
+        Noyaux::soustraire(donnees + i * pas, _autre.data(), dimension);
+    }
+    return *this;
+}
+
+/** \brief Multiplie tous les lments du lot par un scalaire (en place). Le remplissage n'est pas touch: il reste  0.
+ */
+VecteurBatch & VecteurBatch::operator*=(const double _autre){
+    for (size_t i = 0; i < nombreLignes; i++){
+        Noyaux::multiplierScalaire(donnees + i * pas, _autre, dimension);
+    }
+    return *this;
+}
+
+/** \brief Divise tous les lments du lot par un scalaire (en place). Le remplissage n'est pas touch: il reste  0.
+ */
+VecteurBatch & VecteurBatch::operator/=(const double _autre){
+    for (size_t i = 0; i < nombreLignes; i++){
+        Noyaux::diviserScalaire(donnees + i * pas, _autre, dimension);
+    }
+    return *this;
+}
+
+size_t VecteurBatch::getNombreLignes() const {
+    return nombreLignes;
+}
+
+size_t VecteurBatch::getDimension() const {
+    return dimension;
+}
+
+/** \brief Distance (en nombre de doubles) entre le dbut de deux lignes conscutives. Toujours un multiple de 8 (64 octets).
+ */
+size_t VecteurBatch::getPas() const {
+    return pas;
+}
+
+/** \brief Alloue le bloc de mmoire align (remplissage compris, mis  0), puis remplace l'ancien bloc. Si l'allocation choue, le lot reste
+ * tel quel (forme et lments): la nouvelle forme n'est adopte qu'une fois le bloc obtenu.
+ * \param _nombreLignes: nombre de lignes.
+ * \param _dimension: dimension des lignes. Si la taille du bloc ne tient pas dans un size_t, une `length_error` est lance.
+ */
+void VecteurBatch::allouer(const size_t _nombreLignes, const size_t _dimension){
+    const size_t doublesParAlignement = ALIGNEMENT / sizeof(double);
+    const size_t maximum = SIZE_MAX / sizeof(double);
+    if (_dimension > maximum - (doublesParAlignement - 1)){
+        throw length_error("La dimension du lot est trop grande.");
+    }
+    const size_t nouveauPas = (_dimension + doublesParAlignement - 1) / doublesParAlignement * doublesParAlignement;
+    if (nouveauPas != 0 && _nombreLignes > maximum / nouveauPas){
+        throw length_error("Le lot est trop grand.");
+    }
+    const size_t taille = _nombreLignes * nouveauPas;
+    double * nouvellesDonnees = nullptr;
+    if (taille > 0){
+        nouvellesDonnees = static_cast<double *>(::operator new(taille * sizeof(double), align_val_t(ALIGNEMENT)));
+        memset(nouvellesDonnees, 0, taille * sizeof(double));
+    }
+    liberer();
+    donnees = nouvellesDonnees;
+    nombreLignes = _nombreLignes;
+    dimension = _dimension;
+    pas = nouveauPas;
+}
+
+void VecteurBatch::liberer(){
+    if (donnees != nullptr){
+        ::operator delete(donnees, align_val_t(ALIGNEMENT));
+        donnees = nullptr;
+    }
+}
+
+void VecteurBatch::verifierMemeForme(const VecteurBatch & _autre) const {
+    if (nombreLignes != _autre.nombreLignes || dimension != _autre.dimension){
+        throw runtime_error("Les dimensions des lots ne concordent pas.");
+    }
+}
+
+void VecteurBatch::verifierDimension(const Vecteur & _autre) const {
+    if (dimension != _autre.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas entre le lot et le vecteur.");
+    }
+}
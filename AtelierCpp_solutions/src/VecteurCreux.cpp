@@ -0,0 +1,452 @@
+#include "VecteurCreux.h"
+#include "Noyaux.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+/** \brief Constructeur: Vecteur creux de dimension donne, dont tous les lments sont nuls.
+ * \param _dimension: dimension du vecteur.
+ */
+VecteurCreux::VecteurCreux(const size_t _dimension)
+    : dimension(_dimension)
+{
+}
+
+/** \brief Variante du constructeur  partir de paires (index, valeur), dans n'importe quel ordre. Les paires de mme index sont additionnes et
+ * les valeurs nulles ne sont pas conserves.
+ * \param _dimension: dimension du vecteur.
+ * \param _indices: index des lments non nuls. Chacun doit tre strictement plus petit que la dimension.
+ * \param _valeurs: valeurs correspondantes (mme nombre que d'index).
+ */
+VecteurCreux::VecteurCreux(const size_t _dimension, const vector<size_t> & _indices, const vector<double> & _valeurs)
+    : dimension(_dimension)
+{
+    if (_indices.size() != _valeurs.size()){
+        throw runtime_error("Il doit y avoir autant de valeurs que d'index.");
+    }
+    vector<size_t> ordre(_indices.size());
+    iota(ordre.begin(), ordre.end(), size_t(0));
+    if (!is_sorted(_indices.begin(), _indices.end())){
+        stable_sort(ordre.begin(), ordre.end(), [&_indices](const size_t _a, const size_t _b){ return _indices[_a] < _indices[_b]; });
+    }
+    indices.reserve(_indices.size());
+    valeurs.reserve(_valeurs.size());
+    for (size_t k = 0; k < ordre.size(); k++){
+        const size_t index = _indices[ordre[k]];
+        if (index >= dimension){
+            throw runtime_error("L'index est en-dehors du vecteur.");
+        }
+        if (!indices.empty() && indices.back() == index){
+            valeurs.back() += _valeurs[ordre[k]];
+        }
+        else {
+            indices.push_back(index);
+            valeurs.push_back(_valeurs[ordre[k]]);
+        }
+    }
+    // Retire les valeurs nulles (donnes telles quelles ou obtenues en additionnant des doublons).
+    size_t conserves = 0;
+    for (size_t k = 0; k < indices.size(); k++){
+        if (valeurs[k] != 0){
+            indices[conserves] = indices[k];
+            valeurs[conserves] = valeurs[k];
+            conserves++;
+        }
+    }
+    indices.resize(conserves);
+    valeurs.resize(conserves);
+}
+
+/** \brief Conversion d'un Vecteur dense en creux: on garde les lments dont la valeur absolue dpasse `_seuil` (par dfaut, tous les non-nuls),
+ * ainsi que les NaN.
+ * \param _dense: Vecteur  convertir.
+ * \param _seuil: les lments de valeur absolue plus petite ou gale sont considrs nuls.
+ */
+VecteurCreux::VecteurCreux(const Vecteur & _dense, const double _seuil)
+    : dimension(0)
+{
+    construire(_dense.vue(), _seuil);
+}
+
+void VecteurCreux::construire(const VecteurVueConst & _dense, const double _seuil){
+    dimension = _dense.getDimension();
+    indices.clear();
+    valeurs.clear();
+    for (size_t i = 0; i < dimension; i++){
+        const double valeur = _dense.evaluer(i);
+        if (!(fabs(valeur) <= _seuil)){ // NaN est gard: il doit se propager dans les calculs, comme avec le Vecteur dense.
+            indices.push_back(i);
+            valeurs.push_back(valeur);
+        }
+    }
+}
+
+/** \brief Conversion en Vecteur dense: un Vecteur rempli de zros, dans lequel on place les lments non nuls.
+ * \return Le Vecteur dense.
+ */
+Vecteur VecteurCreux::versDense() const {
+    Vecteur retour(dimension, 0);
+    ajouterA(retour.vue());
+    return retour;
+}
+
+/** \brief Accs en lecture  un lment (recherche dichotomique dans les index), avec vrification de l'index.
+ * \param _index: index de l'lment. Doit tre strictement plus petit que la dimension.
+ * \return La valeur de l'lment (0 s'il n'est pas stock).
+ */
+double VecteurCreux::operator[](const size_t _index) const {
+    if (_index >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    return evaluer(_index);
+}
+
+double VecteurCreux::evaluer(const size_t _index) const {
+    const vector<size_t>::const_iterator position = lower_bound(indices.begin(), indices.end(), _index);
+    if (position == indices.end() || *position != _index){
+        return 0;
+    }
+    return valeurs[size_t(position - indices.begin())];
+}
+
+/** \brief Modifie un lment. Donner la valeur 0 retire l'lment des non-nuls. Cote O(k) si l'lment doit tre insr ou retir.
+ * \param _index: index de l'lment. Doit tre strictement plus petit que la dimension.
+ * \param _valeur: nouvelle valeur.
+ */
+void VecteurCreux::definir(const size_t _index, const double _valeur){
+    if (_index >= dimension){
+        throw runtime_error("L'index est en-dehors du vecteur.");
+    }
+    const vector<size_t>::iterator position = lower_bound(indices.begin(), indices.end(), _index);
+    const size_t k = size_t(position - indices.begin());
+    if (position != indices.end() && *position == _index){
+        if (_valeur != 0){
+            valeurs[k] = _valeur;
+        }
+        else {
+            indices.erase(position);
+            valeurs.erase(valeurs.begin() + k);
+        }
+    }
+    else if (_valeur != 0){
+        indices.insert(position, _index);
+        valeurs.insert(valeurs.begin() + k, _valeur);
+    }
+}
+
+/** \brief Fusion de deux listes tries d'index, en appliquant `Op` aux lments (un lment absent d'un ct vaut 0). Les rsultats nuls sont
+ * retirs.
+ */
+template <typename Op>
+VecteurCreux VecteurCreux::fusionner(const VecteurCreux & _autre) const {
+    if (dimension != _autre.dimension){
+        throw runtime_error(Op::messageDimension());
+    }
+    VecteurCreux retour(dimension);
+    retour.indices.reserve(indices.size() + _autre.indices.size());
+    retour.valeurs.reserve(indices.size() + _autre.indices.size());
+    size_t i = 0;
+    size_t j = 0;
+    while (i < indices.size() || j < _autre.indices.size()){
+        size_t index;
+        double valeur;
+        if (j == _autre.indices.size() || (i < indices.size() && indices[i] < _autre.indices[j])){
+            index = indices[i];
+            valeur = Op::appliquer(valeurs[i++], 0.0);
+        }
+        else if (i == indices.size() || _autre.indices[j] < indices[i]){
+            index = _autre.indices[j];
+            valeur = Op::appliquer(0.0, _autre.valeurs[j++]);
+        }
+        else {
+            index = indices[i];
+            valeur = Op::appliquer(valeurs[i++], _autre.valeurs[j++]);
+        }
+        if (valeur != 0){
+            retour.indices.push_back(index);
+            retour.valeurs.push_back(valeur);
+        }
+    }
+    return retour;
+}
+
+/** \brief Addition de deux vecteurs creux. Le rsultat est creux; son nombre de non-nuls est au plus la somme des deux.
+ * \param _autre: vecteur creux de mme dimension.
+ * \return Le vecteur creux rsultant.
+ */
+VecteurCreux VecteurCreux::operator+(const VecteurCreux & _autre) const {
+    return fusionner<OperationAddition>(_autre);
+}
+
+/** \brief Soustraction de deux vecteurs creux (mme logique que l'addition).
+ */
+VecteurCreux VecteurCreux::operator-(const VecteurCreux & _autre) const {
+    return fusionner<OperationSoustraction>(_autre);
+}
+
+/** \brief Produit scalaire entre deux vecteurs creux. Seuls les index prsents des deux cts contribuent:
+ * - si les deux ont un nombre de non-nuls comparable, on parcourt les deux listes tries en mme temps (fusion, O(k1 + k2));
+ * - si l'un est beaucoup plus petit, on cherche chacun de ses index dans l'autre par dichotomie (O(k1 log k2)), en ne recherchant jamais
+ *   avant la position du dernier index trouv.
+ * \param _autre: vecteur creux de mme dimension.
+ * \return Le produit scalaire (double).
+ */
+double VecteurCreux::dot(const VecteurCreux & _autre) const {
+    if (dimension != _autre.dimension){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+    }
+    const VecteurCreux & petit = indices.size() <= _autre.indices.size() ? *this : _autre;
+    const VecteurCreux & grand = indices.size() <= _autre.indices.size() ? _autre : *this;
+    double retour = 0;
+    if (petit.indices.size() * 32 < grand.indices.size()){
+        vector<size_t>::const_iterator position = grand.indices.begin();
+        for (size_t k = 0; k < petit.indices.size(); k++){
+            position = lower_bound(position, grand.indices.end(), petit.indices[k]);
+            if (position == grand.indices.end()){
+                break;
+            }
+            if (*position == petit.indices[k]){
+                retour += petit.valeurs[k] * grand.valeurs[size_t(position - grand.indices.begin())];
+            }
+        }
+        return retour;
+    }
+    size_t i = 0;
+    size_t j = 0;
+    while (i < indices.size() && j < _autre.indices.size()){
+        if (indices[i] < _autre.indices[j]){
+            i++;
+        }
+        else if (_autre.indices[j] < indices[i]){
+            j++;
+        }
+        else {
+            retour += valeurs[i++] * _autre.valeurs[j++];
+        }
+    }
+    return retour;
+}
+
+/** \brief Produit scalaire avec un Vecteur dense: on lit seulement les lments du dense aux index non nuls (O(k) au lieu de O(n)).
+ * \param _dense: Vecteur dense de mme dimension.
+ * \return Le produit scalaire (double).
+ */
+double VecteurCreux::dot(const Vecteur & _dense) const {
+    return produitScalaireDense(_dense.vue());
+}
+
+double VecteurCreux::produitScalaireDense(const VecteurVueConst & _dense) const {
+    if (dimension != _dense.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour le produit scalaire.");
+    }
+    const double * dense = _dense.getDonnees();
+    const size_t pas = _dense.getPas();
+    const size_t nombre = indices.size();
+    // Deux accumulateurs: les lectures indirectes de deux lments conscutifs peuvent se faire en mme temps.
+    double somme0 = 0;
+    double somme1 = 0;
+    size_t k = 0;
+    for (; k + 1 < nombre; k += 2){
+        somme0 += valeurs[k] * dense[indices[k] * pas];
+        somme1 += valeurs[k + 1] * dense[indices[k + 1] * pas];
+    }
+    if (k < nombre){
+        somme0 += valeurs[k] * dense[indices[k] * pas];
+    }
+    return somme0 + somme1;
+}
+
+/** \brief Ajoute `_facteur` fois le vecteur creux  un vecteur dense, en place (`dense += facteur * creux`), en O(k).
+ * \param _dense: vue sur le vecteur dense  modifier (par exemple `v.vue()`). Doit tre de mme dimension.
+ * \param _facteur: facteur multiplicatif (par dfaut 1).
+ */
+void VecteurCreux::ajouterA(const VecteurVue & _dense, const double _facteur) const {
+    if (dimension != _dense.getDimension()){
+        throw runtime_error("Les dimensions ne concordent pas pour l'addition vectorielle.");
+    }
+    double * dense = _dense.getDonnees();
+    const size_t pas = _dense.getPas();
+    for (size_t k = 0; k < indices.size(); k++){
+        dense[indices[k] * pas] += _facteur * valeurs[k];
+    }
+}
+
+/** \brief Multiplication par un scalaire, en place (seules les valeurs non nulles sont touches).
+ */
+VecteurCreux & VecteurCreux::operator*=(const double _autre){
+    Noyaux::multiplierScalaire(valeurs.data(), _autre, valeurs.size());
+    return *this;
+}
+
+/** \brief Division par un scalaire, en place.
+ */
+VecteurCreux & VecteurCreux::operator/=(const double _autre){
+    Noyaux::diviserScalaire(valeurs.data(), _autre, valeurs.size());
+    return *this;
+}
+
+/** \brief Somme des lments: celle des non-nuls (noyau SIMD `Noyaux::somme`).
+ */
+double VecteurCreux::somme() const {
+    return Noyaux::somme(valeurs.data(), valeurs.size());
+}
+
+/** \brief Norme euclidienne: celle des non-nuls (noyau SIMD `Noyaux::sommeCarres`).
+ */
+double VecteurCreux::norme() const {
+    return sqrt(Noyaux::sommeCarres(valeurs.data(), valeurs.size()));
+}
+
+size_t VecteurCreux::getDimension() const {
+    return dimension;
+}
+
+size_t VecteurCreux::getNombreNonNuls() const {
+    return indices.size();
+}
+
+/** \brief Proportion des lments qui sont stocks (entre 0 et 1).
+ */
+double VecteurCreux::getDensite() const {
+    return dimension == 0 ? 0 : double(indices.size()) / double(dimension);
+}
+
+const vector<size_t> & VecteurCreux::getIndices() const {
+    return indices;
+}
+
+const vector<double> & VecteurCreux::getValeurs() const {
+    return valeurs;
+}
+
+/** \brief Addition d'un vecteur dense et d'un vecteur creux: copie du dense, puis ajout des non-nuls. Le rsultat est dense.
+ * \param _dense: Vecteur dense.
+ * \param _creux: vecteur creux de mme dimension.
+ * \return Le Vecteur dense rsultant.
+ */
+Vecteur operator+(const Vecteur & _dense, const VecteurCreux & _creux){
+    Vecteur retour(_dense);
+    _creux.ajouterA(retour.vue());
+    return retour;
+}
+
+Vecteur operator+(const VecteurCreux & _creux, const Vecteur & _dense){
+    return _dense + _creux;
+}
+
+Vecteur operator-(const Vecteur & _dense, const VecteurCreux & _creux){
+    Vecteur retour(_dense);
+    _creux.ajouterA(retour.vue(), -1);
+    return retour;
+}
+
+/** \brief Constructeur  partir d'un Vecteur dense: on compte ses non-nuls et on le garde dense ou on le convertit en creux selon sa densit.
+ * \param _dense: Vecteur  classer.
+ */
+VecteurAdaptatif::VecteurAdaptatif(const Vecteur & _dense)
+    : representation(_dense)
+{
+    optimiser();
+}
+
+/** \brief Constructeur  partir d'un vecteur creux, converti en dense si sa densit est trop leve.
+ * \param _creux: vecteur creux  classer.
+ */
+VecteurAdaptatif::VecteurAdaptatif(const VecteurCreux & _creux)
+    : representation(_creux)
+{
+    optimiser();
+}
+
+/** \brief Vrai si un vecteur de cette densit devrait tre reprsent en creux.
+ * \param _nombreNonNuls: nombre d'lments non nuls.
+ * \param _dimension: dimension du vecteur.
+ */
+bool VecteurAdaptatif::doitEtreCreux(const size_t _nombreNonNuls, const size_t _dimension){
+    return double(_nombreNonNuls) < SEUIL_DENSITE * double(_dimension);
+}
+
+/** \brief Choisit de nouveau la reprsentation selon la densit actuelle (par exemple aprs des modifications).
+ */
+void VecteurAdaptatif::optimiser(){
+    const bool creux = doitEtreCreux(getNombreNonNuls(), getDimension());
+    if (creux && !estCreux()){
+        representation = VecteurCreux(get<Vecteur>(representation));
+    }
+    else if (!creux && estCreux()){
+        representation = get<VecteurCreux>(representation).versDense();
+    }
+}
+
+/** \brief Produit scalaire: dense  dense avec le noyau SIMD, creux  dense en lisant seulement les non-nuls, creux  creux par fusion.
+ * \param _autre: vecteur de mme dimension.
+ * \return Le produit scalaire (double).
+ */
+double VecteurAdaptatif::dot(const VecteurAdaptatif & _autre) const {
+    if (estCreux()){
+        const VecteurCreux & creux = get<VecteurCreux>(representation);
+        return _autre.estCreux() ? creux.dot(get<VecteurCreux>(_autre.representation)) : creux.dot(get<Vecteur>(_autre.representation));
+    }
+    const Vecteur & dense = get<Vecteur>(representation);
+    return _autre.estCreux() ? get<VecteurCreux>(_autre.representation).dot(dense) : dense.dot(get<Vecteur>(_autre.representation));
+}
+
+/** \brief Addition. Le rsultat est reclass selon sa densit (la somme de deux vecteurs creux peut devenir dense).
+ * \param _autre: vecteur de mme dimension.
+ * \return Le vecteur rsultant.
+ */
+VecteurAdaptatif VecteurAdaptatif::operator+(const VecteurAdaptatif & _autre) const {
+    if (estCreux() && _autre.estCreux()){
+        return VecteurAdaptatif(get<VecteurCreux>(representation) + get<VecteurCreux>(_autre.representation));
+    }
+    if (estCreux()){
+        return VecteurAdaptatif(get<VecteurCreux>(representation) + get<Vecteur>(_autre.representation));
+    }
+    if (_autre.estCreux()){
+        return VecteurAdaptatif(get<Vecteur>(representation) + get<VecteurCreux>(_autre.representation));
+    }
+    return VecteurAdaptatif(Vecteur(get<Vecteur>(representation) + get<Vecteur>(_autre.representation)));
+}
+
+double VecteurAdaptatif::somme() const {
+    return estCreux() ? get<VecteurCreux>(representation).somme() : get<Vecteur>(representation).somme();
+}
+
+double VecteurAdaptatif::norme() const {
+    return estCreux() ? get<VecteurCreux>(representation).norme() : get<Vecteur>(representation).norme();
+}
+
+/** \brief Copie en Vecteur dense, peu importe la reprsentation.
+ */
+Vecteur VecteurAdaptatif::versDense() const {
+    return estCreux() ? get<VecteurCreux>(representation).versDense() : get<Vecteur>(representation);
+}
+
+/** \brief Copie en vecteur creux, peu importe la reprsentation.
+ */
+VecteurCreux VecteurAdaptatif::versCreux() const {
+    return estCreux() ? get<VecteurCreux>(representation) : VecteurCreux(get<Vecteur>(representation));
+}
+
+bool VecteurAdaptatif::estCreux() const {
+    return holds_alternative<VecteurCreux>(representation);
+}
+
+size_t VecteurAdaptatif::getDimension() const {
+    return estCreux() ? get<VecteurCreux>(representation).getDimension() : get<Vecteur>(representation).getDimension();
+}
+
+/** \brief Nombre d'lments non nuls (pour la forme dense, on les compte: O(n)).
+ */
+size_t VecteurAdaptatif::getNombreNonNuls() const {
+    if (estCreux()){
+        return get<VecteurCreux>(representation).getNombreNonNuls();
+    }
+    const VecteurVueConst dense = get<Vecteur>(representation).vue();
+    size_t retour = 0;
+    for (size_t i = 0; i < dense.getDimension(); i++){
+        retour += dense.evaluer(i) != 0;
+    }
+    return retour;
+}
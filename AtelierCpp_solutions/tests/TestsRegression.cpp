@@ -0,0 +1,677 @@
+#include "Vecteur.h"
+#include "ExecutionAsynchrone.h"
+#include "FichierVecteur.h"
+#include "Matrice.h"
+#include "Noyaux.h"
+#include "RechercheVoisins.h"
+#include "VecteurBatch.h"
+#include "VecteurCompact.h"
+#include "VecteurCreux.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/** \brief Tests de rgression: chaque cas vrifie un comportement prcis (cas limites, valeurs spciales, erreurs), contrairement aux tests de
+ * concordance de ChargeRepresentative.cpp, qui comparent seulement des variantes entre elles. Chaque cas est un test ctest spar (voir
+ * CMakeLists.txt).
+ *
+ * Utilisation:
+ *   tests_regression             excute tous les cas
+ *   tests_regression <nom>...    excute seulement les cas nomms
+ *   tests_regression --liste     affiche le nom des cas
+ * Le code de retour est 0 si toutes les vrifications ont russi.
+ */
+
+namespace
+{
+    int nombreEchecs = 0;
+
+    // Nombre d'allocations alignes encore permises avant de lancer bad_alloc (-1: aucune limite), pour simuler un manque de mmoire.
+    int allocationsAligneesPermises = -1;
+
+    void verifier(const bool _condition, const char * _expression, const char * _fichier, const int _ligne){
+        if (!_condition){
+            fprintf(stderr, "%s:%d: chec: %s\n", _fichier, _ligne, _expression);
+            nombreEchecs++;
+        }
+    }
+
+#define VERIFIER(condition) verifier((condition), #condition, __FILE__, __LINE__)
+
+    /** \brief Vrai si `_fonction()` lance une exception de type `Exception`.
+     */
+    template <typename Exception, typename Fonction>
+    bool lance(Fonction _fonction){
+        try {
+            _fonction();
+        }
+        catch (const Exception &){
+            return true;
+        }
+        catch (...){
+            return false;
+        }
+        return false;
+    }
+
+    /** \brief Erreur de `_valeur` par rapport  `_exacte`, en ulp du rsultat (unit du dernier chiffre du double le plus proche de `_exacte`).
+     */
+    double erreurUlp(const double _valeur, const long double _exacte){
+        const double arrondie = double(_exacte);
+        const double ulp = arrondie == 0 || fabs(arrondie) < DBL_MIN ? ldexp(1.0, -1074) : ldexp(1.0, ilogb(arrondie) - 52);
+        return double(fabsl((long double)_valeur - _exacte) / ulp);
+    }
+
+    /** \brief Vrai si les deux doubles sont identiques, bit pour bit, ou sont tous les deux NaN.
+     */
+    bool memeValeur(const double _a, const double _b){
+        return (std::isnan(_a) && std::isnan(_b)) || memcmp(&_a, &_b, sizeof(double)) == 0;
+    }
+
+    Vecteur aleatoire(const size_t _dimension, mt19937_64 & _generateur){
+        normal_distribution<double> normale;
+        Vecteur retour(_dimension, 0.0);
+        for (size_t i = 0; i < _dimension; i++){
+            retour[i] = normale(_generateur);
+        }
+        return retour;
+    }
+
+    /** \brief Excute `_fonction()` avec chaque jeu d'instructions support, puis revient au jeu initial.
+     */
+    template <typename Fonction>
+    void pourChaqueJeu(Fonction _fonction){
+        const Noyaux::JeuInstructions initial = Noyaux::jeuInstructions();
+        const Noyaux::JeuInstructions detecte = Noyaux::jeuInstructionsDetecte();
+        for (int jeu = Noyaux::SCALAIRE; jeu <= detecte; jeu++){
+            Noyaux::choisirJeuInstructions(Noyaux::JeuInstructions(jeu));
+            _fonction();
+        }
+        Noyaux::choisirJeuInstructions(initial);
+    }
+
+    // Produit scalaire: borne d'erreur de Noyaux.h par rapport  un calcul en long double, et valeurs spciales.
+    void testProduitScalaire(){
+        mt19937_64 generateur(1);
+        const Vecteur a = aleatoire(10007, generateur);
+        const Vecteur b = aleatoire(10007, generateur);
+        long double reference = 0;
+        double sommeAbsolue = 0;
+        for (size_t i = 0; i < a.getDimension(); i++){
+            reference += (long double)a[i] * b[i];
+            sommeAbsolue += fabs(a[i] * b[i]);
+        }
+        pourChaqueJeu([&](){
+            const double borne = (a.getDimension() / 4.0 + 8) * ldexp(1.0, -53) * sommeAbsolue;
+            VERIFIER(fabs(a.dot(b) - double(reference)) <= borne);
+            VERIFIER(fabs(a.dot(b, Noyaux::COMPENSEE) - double(reference)) <= ldexp(fabs(double(reference)), -52));
+        });
+
+        Vecteur c = a;
+        c[5000] = NAN;
+        VERIFIER(std::isnan(c.dot(b)));
+        c[5000] = INFINITY;
+        VERIFIER(std::isinf(c.dot(b)));
+    }
+
+    // Fichiers: aller-retour exact, et en-ttes invalides (fichier tronqu, lments mal aligns) rejets.
+    void testFichier(){
+        mt19937_64 generateur(2);
+        const Vecteur a = aleatoire(1001, generateur);
+        const string chemin = "tests_regression_fichier.vec";
+        FichierVecteur::ecrire(chemin, a);
+        const Vecteur lu = FichierVecteur::lire(chemin);
+        VERIFIER(lu.getDimension() == a.getDimension());
+        VERIFIER(memcmp(lu.data(), a.data(), a.getDimension() * sizeof(double)) == 0);
+        {
+            const VecteurMappe mappe(chemin);
+            VERIFIER(mappe.getDimension() == a.getDimension());
+            VERIFIER(reinterpret_cast<uintptr_t>(mappe.getDonnees()) % EnteteFichierVecteur::ALIGNEMENT == 0);
+            VERIFIER(memeValeur(mappe.dot(mappe), a.dot(a)));
+        }
+
+        // Fichier tronqu
+        EnteteFichierVecteur entete = FichierVecteur::lireEntete(chemin);
+        entete.dimension = 1002;
+        FILE * fichier = fopen(chemin.c_str(), "r+b");
+        VERIFIER(fichier != nullptr);
+        if (fichier != nullptr){
+            fwrite(&entete, sizeof(entete), 1, fichier);
+            fclose(fichier);
+        }
+        VERIFIER(lance<runtime_error>([&](){ FichierVecteur::lire(chemin); }));
+        VERIFIER(lance<runtime_error>([&](){ VecteurMappe mappe(chemin); }));
+
+        // lments mal aligns (un double* mal align serait un comportement indfini), puis alignement plus grand, mais valide.
+        const uint64_t alignements[][2] = {{1, 67}, {8, 72}, {32, 96}, {128, 128}};
+        for (const auto & alignement : alignements){
+            entete.dimension = 3;
+            entete.alignement = alignement[0];
+            entete.decalageDonnees = alignement[1];
+            vector<char> octets(size_t(entete.decalageDonnees + 3 * sizeof(double)), 0);
+            memcpy(octets.data(), &entete, sizeof(entete));
+            memcpy(octets.data() + entete.decalageDonnees, a.data(), 3 * sizeof(double));
+            fichier = fopen(chemin.c_str(), "wb");
+            VERIFIER(fichier != nullptr);
+            if (fichier != nullptr){
+                fwrite(octets.data(), 1, octets.size(), fichier);
+                fclose(fichier);
+            }
+            const bool valide = alignement[0] % EnteteFichierVecteur::ALIGNEMENT == 0;
+            VERIFIER(lance<runtime_error>([&](){ FichierVecteur::lireEntete(chemin); }) != valide);
+            VERIFIER(lance<runtime_error>([&](){ FichierVecteur::lire(chemin); }) != valide);
+            VERIFIER(lance<runtime_error>([&](){ VecteurMappe mappe(chemin); }) != valide);
+            if (valide){
+                const VecteurMappe mappe(chemin);
+                VERIFIER(mappe.getDimension() == 3 && mappe[2] == a[2]);
+                VERIFIER(reinterpret_cast<uintptr_t>(mappe.getDonnees()) % EnteteFichierVecteur::ALIGNEMENT == 0);
+            }
+        }
+        remove(chemin.c_str());
+    }
+
+    // Puissances: Noyaux::puissance compar au rsultat correctement arrondi (powl en long double), avec les bornes en ulp de Noyaux.h, et
+    // valeurs spciales identiques  pow.
+    void testPuissance(){
+        mt19937_64 generateur(3);
+        uniform_real_distribution<double> uniforme(-30, 30);
+        vector<double> source;
+        for (size_t i = 0; i < 4096; i++){
+            source.push_back(exp(uniforme(generateur)));
+        }
+        // Sous-normaux (hors du domaine du noyau gnral) et grandeurs extrmes: x^|p| peut dpasser ou devenir sous-normal alors que x^p est
+        // reprsentable (1e160^-2 = 1e-320).
+        const double extremes[] = {4.9e-324, 2.2e-310, 1e160, -1e160, 1.5e154, -3e155, 1e300, DBL_MAX, 1.1e-154, -1e-160, 1e-155, DBL_MIN};
+        source.insert(source.end(), begin(extremes), end(extremes));
+        const vector<double> speciales = {0.0, -0.0, INFINITY, -INFINITY, NAN, 1.0, -1.0, -2.5};
+
+        const double puissances[] = {2, 3, 4, -1, -2, 0.5, 1.5, 2.5, -0.5, 0.25, -0.25, 1.7, -3.3, 12.5};
+        const double ulpPermis[] = {0.5, 1.3, 1.9, 0.5, 1.5, 0.5, 1.3, 1.9, 1.5, 0.8, 1.9, 1.05, 1.05, 1.5};
+        pourChaqueJeu([&](){
+            vector<double> destination(source.size());
+            vector<double> destinationSpeciales(speciales.size());
+            for (size_t p = 0; p < sizeof(puissances) / sizeof(puissances[0]); p++){
+                Noyaux::puissance(destination.data(), source.data(), puissances[p], source.size());
+                for (size_t i = 0; i < source.size(); i++){
+                    const long double exacte = powl((long double)source[i], (long double)puissances[p]);
+                    // powl est prcis  environ 0.001 ulp. Au-del du plus grand double (inf) ou pour x < 0 (NaN), mme valeur que powl.
+                    const bool concorde = !std::isfinite(double(exacte)) ? memeValeur(destination[i], double(exacte))
+                                                                    : erreurUlp(destination[i], exacte) <= ulpPermis[p] + 0.01;
+                    if (!concorde){
+                        fprintf(stderr, "  %.17g^%g: %.17g (%.2f ulp) (%s)\n", source[i], puissances[p], destination[i],
+                                erreurUlp(destination[i], exacte), Noyaux::nomJeuInstructions(Noyaux::jeuInstructions()));
+                    }
+                    VERIFIER(concorde);
+                }
+                Noyaux::puissance(destinationSpeciales.data(), speciales.data(), puissances[p], speciales.size());
+                for (size_t i = 0; i < speciales.size(); i++){
+                    const bool concorde = memeValeur(destinationSpeciales[i], pow(speciales[i], puissances[p]));
+                    if (!concorde){
+                        fprintf(stderr, "  %.17g^%g: %.17g au lieu de %.17g (%s)\n", speciales[i], puissances[p], destinationSpeciales[i],
+                                pow(speciales[i], puissances[p]), Noyaux::nomJeuInstructions(Noyaux::jeuInstructions()));
+                    }
+                    VERIFIER(concorde);
+                }
+            }
+
+            // x^2 infini, alors que x^-2 est sous-normal; calcul en place (la source est relue aprs l'criture des autres voies).
+            double enPlace[5] = {1e160, 2.0, -1e160, 3e155, 0.5};
+            Noyaux::puissance(enPlace, enPlace, -2, 5);
+            VERIFIER(enPlace[0] == pow(1e160, -2) && enPlace[0] == 9.9998886718268301e-321);
+            VERIFIER(enPlace[1] == 0.25 && enPlace[2] == enPlace[0] && enPlace[3] == pow(3e155, -2) && enPlace[4] == 4);
+        });
+    }
+
+    // Matrice: produits compars  un calcul en long double, y compris pour les formes limites.
+    void testMatrice(){
+        mt19937_64 generateur(4);
+        const size_t formes[][2] = {{0, 5}, {5, 0}, {1, 1}, {7, 13}, {64, 257}};
+        pourChaqueJeu([&](){
+            for (const auto & forme : formes){
+                const size_t m = forme[0], n = forme[1];
+                Matrice matrice(m, n);
+                for (size_t i = 0; i < m; i++){
+                    matrice.definirLigne(i, aleatoire(n, generateur));
+                }
+                const Vecteur x = aleatoire(n, generateur);
+                const Vecteur y = matrice.produit(x);
+                VERIFIER(y.getDimension() == m);
+                for (size_t i = 0; i < y.getDimension(); i++){
+                    long double reference = 0;
+                    double sommeAbsolue = 0;
+                    for (size_t j = 0; j < n; j++){
+                        reference += (long double)matrice(i, j) * x[j];
+                        sommeAbsolue += fabs(matrice(i, j) * x[j]);
+                    }
+                    VERIFIER(fabs(y[i] - double(reference)) <= (n + 8) * ldexp(1.0, -53) * sommeAbsolue);
+                }
+                VERIFIER(lance<runtime_error>([&](){ matrice.produit(Vecteur(n + 1, 0.0)); }));
+            }
+        });
+    }
+
+    // Itrateur d'expression: toutes les oprations d'un itrateur  accs alatoire.
+    void testIterateurExpression(){
+        const Vecteur a(0.0, 100.0, 1.0);
+        const Vecteur b(100, 0.5);
+        const auto expression = a + b;
+        typedef IterateurExpression<ExpressionBinaire<Vecteur, Vecteur, OperationAddition>> Iterateur;
+        // Itrateur mandataire: catgorie  accs alatoire (pour que vector::assign alloue une seule fois), lments retourns par valeur.
+        static_assert(is_same<iterator_traits<Iterateur>::iterator_category, random_access_iterator_tag>::value,
+                      "IterateurExpression doit tre  accs alatoire.");
+        static_assert(is_same<iterator_traits<Iterateur>::reference, double>::value, "IterateurExpression retourne les lments par valeur.");
+        const Iterateur debut(expression, 0);
+        const Iterateur fin(expression, 100);
+        VERIFIER(fin - debut == 100);
+        VERIFIER(distance(debut, fin) == 100);
+        VERIFIER(*(debut + 10) == 10.5 && *(10 + debut) == 10.5 && *(fin - 1) == 99.5 && debut[42] == 42.5);
+        VERIFIER(debut < fin && fin > debut && debut <= debut && fin >= fin && !(fin < debut) && !(debut >= fin));
+        Iterateur courant = debut;
+        courant += 20;
+        courant -= 5;
+        VERIFIER(*courant == 15.5 && *courant++ == 15.5 && *--courant == 15.5);
+        VERIFIER(lower_bound(debut, fin, 57.0) - debut == 57);
+        VERIFIER(Vecteur(expression).getDimension() == 100);
+    }
+
+    // VecteurBatch: une allocation qui choue (taille trop grande ou mmoire insuffisante) laisse le lot intact.
+    void testLotAllocation(){
+        VERIFIER(lance<length_error>([](){ VecteurBatch lot(SIZE_MAX / 16, 16); }));
+        VERIFIER(lance<length_error>([](){ VecteurBatch lot(2, SIZE_MAX - 3); }));
+
+        VecteurBatch lot(3, 5, 1.5);
+        const VecteurBatch autre(4, 9, 2.5);
+        allocationsAligneesPermises = 0;
+        VERIFIER(lance<bad_alloc>([&](){ lot = autre; }));
+        allocationsAligneesPermises = -1;
+        VERIFIER(lot.getNombreLignes() == 3 && lot.getDimension() == 5 && lot.getPas() == 8 && lot.data() != nullptr);
+        VERIFIER(lot(2, 4) == 1.5);
+
+        lot = autre;
+        VERIFIER(lot.getNombreLignes() == 4 && lot.getDimension() == 9 && lot(3, 8) == 2.5);
+        VecteurBatch vide(0, 0);
+        vide = lot;
+        VERIFIER(vide.getNombreLignes() == 4 && vide(1, 1) == 2.5);
+    }
+
+    // Tranches de vues: nombre d'lments et pas sans dpassement, mme pour un pas immense; accs vrifi avec at().
+    void testVueTranche(){
+        Vecteur a(0.0, 10.0, 1.0);
+        const VecteurVue vue = a.tranche(1, 10, 3);
+        VERIFIER(vue.getDimension() == 3 && vue[2] == 7 && vue.getPas() == 3);
+        VERIFIER(a.tranche(4, 10, SIZE_MAX).getDimension() == 1 && a.tranche(4, 10, SIZE_MAX)[0] == 4);
+        VERIFIER(a.tranche(4, 4, SIZE_MAX).getDimension() == 0);
+        VERIFIER(vue.tranche(0, 3, SIZE_MAX - 1).getDimension() == 1);
+        VERIFIER(vue.tranche(1, 3, 2).getDimension() == 1 && vue.tranche(1, 3, 2)[0] == 4);
+        VERIFIER(vue.tranche(0, 3, 2).getDimension() == 2 && vue.tranche(0, 3, 2)[1] == 7);
+        VERIFIER(lance<runtime_error>([&](){ a.tranche(0, 11); }));
+        VERIFIER(lance<runtime_error>([&](){ a.tranche(0, 5, 0); }));
+
+        // Vue dont le pas est dj immense: le produit des pas ne tient plus dans un size_t.
+        const VecteurVue large(a.data(), 3, SIZE_MAX / 2 + 1);
+        VERIFIER(lance<runtime_error>([&](){ large.tranche(0, 3, 2); }));
+        VERIFIER(large.tranche(0, 3, 4).getDimension() == 1);
+
+        VERIFIER(vue.at(2) == 7);
+        VERIFIER(lance<runtime_error>([&](){ vue.at(3); }));
+    }
+
+    // Texte: aller-retour exact avec toString(), sans rserver la taille maximale du texte.
+    void testTexte(){
+        mt19937_64 generateur(5);
+        const Vecteur a = aleatoire(1000, generateur);
+        const string texte = a.toString();
+        istringstream entree(texte);
+        const Vecteur lu(entree);
+        VERIFIER(lu.getDimension() == a.getDimension());
+        VERIFIER(memcmp(lu.data(), a.data(), a.getDimension() * sizeof(double)) == 0);
+        VERIFIER(texte.capacity() <= 2 * texte.size());
+        VERIFIER(Vecteur(0, 0.0).toString() == "[]");
+    }
+
+    // Vecteurs creux: un NaN (ou un infini) du Vecteur dense est conserv, et se propage comme dans le calcul dense.
+    void testCreuxValeursSpeciales(){
+        Vecteur dense(1000, 0.0);
+        dense[3] = 2.0;
+        dense[500] = NAN;
+        dense[900] = 1.5;
+        const Vecteur autre(1000, 1.0);
+        const VecteurCreux creux(dense);
+        VERIFIER(creux.getNombreNonNuls() == 3);
+        VERIFIER(std::isnan(dense.dot(autre)) && std::isnan(creux.dot(autre)) && std::isnan(creux.somme()));
+        VERIFIER(std::isnan(creux.versDense()[500]));
+        VERIFIER(VecteurAdaptatif(dense).getNombreNonNuls() == VecteurAdaptatif(creux).getNombreNonNuls());
+        VERIFIER(VecteurCreux(dense, 10.0).getNombreNonNuls() == 1);
+
+        dense[500] = -INFINITY;
+        VERIFIER(VecteurCreux(dense, 10.0).dot(autre) == -INFINITY);
+    }
+
+    // Quantification int8: erreur d'au plus chelle / 2 par lment; infinis et NaN refuss (ils ne sont pas reprsentables).
+    void testQuantificationInt8(){
+        mt19937_64 generateur(6);
+        Vecteur a = aleatoire(1000, generateur);
+        const VecteurInt8 quantifie(a);
+        for (size_t i = 0; i < a.getDimension(); i++){
+            VERIFIER(fabs(quantifie[i] - a[i]) <= quantifie.getEchelle() / 2 * (1 + 1e-12));
+        }
+        VERIFIER(VecteurInt8(Vecteur(10, 0.0)).norme() == 0);
+        VERIFIER(VecteurInt8(Vecteur(10, 4.9e-324)).somme() == 10 * 4.9e-324);
+
+        a[17] = INFINITY;
+        VERIFIER(lance<runtime_error>([&](){ VecteurInt8 refuse(a); }));
+        a[17] = -INFINITY;
+        VERIFIER(lance<runtime_error>([&](){ VecteurInt8 refuse(a); }));
+        a[17] = NAN;
+        VERIFIER(lance<runtime_error>([&](){ VecteurInt8 refuse(a); }));
+        VERIFIER(std::isnan(VecteurFloat(a)[17]) && std::isnan(VecteurBfloat16(a)[17]));
+    }
+
+    // Excuteur born: jamais plus de `getCapacite()` tches en cours, rsultats et exceptions rendus par les future, soumission par
+    // plusieurs fils  la fois.
+    void testExecuteurBorne(){
+        ReservoirTaches reservoir(3);
+        atomic<int> enCours(0);
+        atomic<int> maximum(0);
+        vector<future<size_t> > resultats;
+        {
+            ExecuteurBorne executeur(2, reservoir);
+            for (size_t i = 0; i < 200; i++){
+                resultats.push_back(executeur.soumettre([&enCours, &maximum, i]() {
+                    const int courant = ++enCours;
+                    int precedent = maximum.load();
+                    while (courant > precedent && !maximum.compare_exchange_weak(precedent, courant)){
+                    }
+                    this_thread::yield();
+                    enCours--;
+                    return i * i;
+                }));
+                VERIFIER(executeur.getEnCours() <= 2);
+            }
+            future<int> echec = executeur.soumettre([]() -> int { throw runtime_error("chec voulu"); });
+            executeur.attendre();
+            VERIFIER(executeur.getEnCours() == 0);
+            VERIFIER(lance<runtime_error>([&](){ echec.get(); }));
+        }
+        VERIFIER(maximum.load() >= 1 && maximum.load() <= 2);
+        bool exacts = true;
+        for (size_t i = 0; i < resultats.size(); i++){
+            exacts = exacts && resultats[i].get() == i * i;
+        }
+        VERIFIER(exacts);
+
+        // Plusieurs producteurs: chaque tche est excute une seule fois, et le destructeur attend les dernires.
+        atomic<size_t> somme(0);
+        {
+            ExecuteurBorne executeur(4, reservoir);
+            vector<thread> producteurs;
+            for (size_t p = 0; p < 4; p++){
+                producteurs.emplace_back([&executeur, &somme, p]() {
+                    for (size_t i = 0; i < 250; i++){
+                        executeur.soumettre([&somme, p, i]() { somme += p * 1000 + i; });
+                    }
+                });
+            }
+            for (thread & producteur : producteurs){
+                producteur.join();
+            }
+        }
+        VERIFIER(somme.load() == 250 * (0 + 1000 + 2000 + 3000) + 4 * (249 * 250 / 2));
+    }
+
+    // Pipeline: chaque lment passe une seule fois par chaque tape, dans l'ordre, en alternant les rservoirs; une exception est relance
+    // par terminer() (puis le pipeline est rutilisable); le destructeur traite les lments restants sans lancer d'exception.
+    void testPipeline(){
+        ReservoirTaches calcul(2);
+        ReservoirTaches entreesSorties(2);
+        struct Travail
+        {
+            size_t valeur;
+            int etapes;
+        };
+        atomic<size_t> somme(0);
+        {
+            Pipeline<Travail> pipeline(7, 3, calcul, entreesSorties);
+            pipeline.ajouterEtape([](Travail & _t) { _t.etapes = _t.etapes * 10 + 1; }, Pipeline<Travail>::ENTREES_SORTIES)
+                    .ajouterEtape([](Travail & _t) { _t.etapes = _t.etapes * 10 + 2; _t.valeur *= 2; })
+                    .ajouterEtape([](Travail & _t) { _t.etapes = _t.etapes * 10 + 3; })
+                    .ajouterEtape([&somme](Travail & _t) {
+                        if (_t.etapes == 123){
+                            somme += _t.valeur;
+                        }
+                    }, Pipeline<Travail>::ENTREES_SORTIES);
+            for (size_t i = 0; i < 1000; i++){
+                pipeline.pousser(Travail{i, 0});
+            }
+            pipeline.terminer();
+            VERIFIER(pipeline.getNombreTraites() == 1000);
+            VERIFIER(somme.load() == 999 * 1000);
+        }
+
+        // Exception dans une tape: relance une seule fois par terminer(), les autres lots sont traits.
+        {
+            Pipeline<Travail> pipeline(4, 2, calcul, entreesSorties);
+            pipeline.ajouterEtape([](Travail & _t) {
+                if (_t.valeur == 13){
+                    throw runtime_error("chec voulu");
+                }
+            });
+            for (size_t i = 0; i < 100; i++){
+                pipeline.pousser(Travail{i, 0});
+            }
+            VERIFIER(lance<runtime_error>([&](){ pipeline.terminer(); }));
+            VERIFIER(pipeline.getNombreTraites() == 96);
+            pipeline.pousser(Travail{1, 0});
+            pipeline.terminer();
+            VERIFIER(pipeline.getNombreTraites() == 97);
+        }
+
+        // Destruction sans terminer(), avec une tape qui choue: aucun appel  std::terminate, les lments pousss sont traits.
+        atomic<size_t> traites(0);
+        {
+            Pipeline<Travail> pipeline(8, 2, calcul, entreesSorties);
+            pipeline.ajouterEtape([&traites](Travail & _t) {
+                traites++;
+                if (_t.valeur == 2){
+                    throw runtime_error("chec voulu");
+                }
+            }, Pipeline<Travail>::ENTREES_SORTIES);
+            for (size_t i = 0; i < 21; i++){
+                pipeline.pousser(Travail{i, 0});
+            }
+        }
+        VERIFIER(traites.load() == 3 + 8 + 5); // Premier lot abandonn aprs l'lment 2, puis un lot complet et le lot incomplet.
+    }
+
+    // Assignation chevauchante: une expression qui lit d'autres lments de sa destination donne le mme rsultat en parallle qu'en squentiel,
+    // et une vue peut recevoir une tranche dcale d'elle-mme.
+    void testAssignationChevauchante(){
+        const size_t n = 262144;
+        mt19937_64 generateur(6);
+        const Vecteur original = aleatoire(n, generateur);
+        Vecteur attendu = original;
+        attendu = attendu.tranche(1, n);
+        Vecteur parallele = original;
+        parallele.assigner(parallele.tranche(1, n), PolitiqueExecution::parallele(1024, true));
+        VERIFIER(parallele.getDimension() == n - 1);
+        VERIFIER(memcmp(parallele.data(), attendu.data(), (n - 1) * sizeof(double)) == 0);
+
+        Vecteur somme = original;
+        somme.assigner(somme + somme.tranche(0, n, 1) * 2.0, PolitiqueExecution::parallele(1024, true));
+        VERIFIER(somme[7] == original[7] * 3.0);
+
+        Vecteur decale = original;
+        decale.tranche(1, n) = decale.tranche(0, n - 1);
+        VERIFIER(decale[0] == original[0] && decale[1] == original[0] && decale[n - 1] == original[n - 2]);
+        Vecteur accumule = original;
+        accumule.tranche(1, n) += accumule.tranche(0, n - 1);
+        VERIFIER(accumule[2] == original[2] + original[1] && accumule[n - 1] == original[n - 1] + original[n - 2]);
+        Vecteur pairs = original;
+        pairs.tranche(0, n / 2) = pairs.tranche(0, n, 2) * 1.0;
+        VERIFIER(pairs[3] == original[6] && pairs[n / 2 - 1] == original[n - 2]);
+    }
+
+    /** \brief Index des voisins, dans l'ordre.
+     */
+    vector<size_t> indexVoisins(const vector<Voisin> & _voisins){
+        vector<size_t> retour;
+        for (size_t i = 0; i < _voisins.size(); i++){
+            retour.push_back(_voisins[i].index);
+        }
+        return retour;
+    }
+
+    // Recherche de voisins: un vecteur qui contient un NaN est class en dernier sans dranger les autres, et un k immense retourne tous les
+    // vecteurs sans rserver k places.
+    void testRechercheVoisins(){
+        VecteurBatch lignes(50, 4);
+        for (size_t i = 0; i < 50; i++){
+            lignes.ligne(i)[0] = i % 5 == 0 ? NAN : double(i);
+        }
+        Vecteur requete(4, 0.0);
+        requete[0] = 1;
+        const RechercheVoisins produit(lignes, RechercheVoisins::PRODUIT_SCALAIRE);
+        VERIFIER(indexVoisins(produit.chercher(requete, 5)) == vector<size_t>({49, 48, 47, 46, 44}));
+        VERIFIER(indexVoisins(produit.chercher(requete, 5, PolitiqueExecution::parallele(8, true)))
+                 == vector<size_t>({49, 48, 47, 46, 44}));
+        const vector<Voisin> tous = produit.chercher(requete, SIZE_MAX);
+        VERIFIER(tous.size() == 50 && tous[39].index == 1 && tous[40].index == 0 && tous[49].index == 45);
+
+        requete[0] = 8;
+        const RechercheVoisins l2(lignes, RechercheVoisins::L2);
+        const vector<Voisin> proches = l2.chercher(requete, 5);
+        VERIFIER(indexVoisins(proches) == vector<size_t>({8, 7, 9, 6, 11}));
+        VERIFIER(proches[0].score == 0);
+        VERIFIER(l2.chercher(requete, size_t(1) << 40).size() == 50);
+        VecteurBatch deuxRequetes(2, 4);
+        deuxRequetes.ligne(1)[0] = 16;
+        const vector<vector<Voisin> > parRequete = l2.chercher(deuxRequetes, SIZE_MAX);
+        VERIFIER(parRequete.size() == 2 && parRequete[1].size() == 50 && parRequete[1][0].index == 16 && parRequete[1][0].score == 0);
+
+        VecteurBatch finies(50, 4);
+        for (size_t i = 0; i < 50; i++){
+            finies.ligne(i)[0] = double(i);
+        }
+        const IndexIVF index(finies, RechercheVoisins::L2, 4);
+        VERIFIER(index.chercher(requete, SIZE_MAX, 4).size() == 50);
+        VERIFIER(index.chercher(requete, 3, SIZE_MAX)[0].index == 8);
+    }
+
+    // Copie dans une ressource mmoire borne: si la copie manque de mmoire, le Vecteur garde ses lments et sa dimension.
+    void testCopieMemoireBornee(){
+        alignas(64) char tampon[1024];
+        pmr::monotonic_buffer_resource arene(tampon, sizeof(tampon), pmr::null_memory_resource());
+        Vecteur petit(4, 1.0, &arene);
+        const Vecteur grand(1000, 2.0);
+        VERIFIER(lance<bad_alloc>([&](){ petit = grand; }));
+        VERIFIER(petit.getDimension() == 4 && size_t(petit.end() - petit.begin()) == 4);
+        VERIFIER(petit[3] == 1.0 && petit.somme() == 4.0);
+    }
+
+    struct Cas
+    {
+        const char * nom;
+        void (*fonction)();
+    };
+
+    const Cas CAS[] = {
+        {"produit_scalaire", testProduitScalaire},
+        {"fichier", testFichier},
+        {"puissance", testPuissance},
+        {"matrice", testMatrice},
+        {"iterateur_expression", testIterateurExpression},
+        {"lot_allocation", testLotAllocation},
+        {"vue_tranche", testVueTranche},
+        {"texte", testTexte},
+        {"creux_valeurs_speciales", testCreuxValeursSpeciales},
+        {"quantification_int8", testQuantificationInt8},
+        {"executeur_borne", testExecuteurBorne},
+        {"pipeline", testPipeline},
+        {"assignation_chevauchante", testAssignationChevauchante},
+        {"recherche_voisins", testRechercheVoisins},
+        {"copie_memoire_bornee", testCopieMemoireBornee},
+    };
+}
+
+// Allocations alignes (VecteurBatch), avec l'chec simul de `allocationsAligneesPermises`. Le pointeur d'origine est gard juste avant le bloc.
+void * operator new(size_t _taille, align_val_t _alignement){
+    if (allocationsAligneesPermises == 0){
+        throw bad_alloc();
+    }
+    if (allocationsAligneesPermises > 0){
+        allocationsAligneesPermises--;
+    }
+    const size_t alignement = size_t(_alignement);
+    void * brut = malloc(_taille + alignement + sizeof(void *));
+    if (brut == nullptr){
+        throw bad_alloc();
+    }
+    const uintptr_t adresse = (reinterpret_cast<uintptr_t>(brut) + sizeof(void *) + alignement - 1) & ~uintptr_t(alignement - 1);
+    reinterpret_cast<void **>(adresse)[-1] = brut;
+    return reinterpret_cast<void *>(adresse);
+}
+
+void operator delete(void * _pointeur, align_val_t) noexcept {
+    if (_pointeur != nullptr){
+        free(static_cast<void **>(_pointeur)[-1]);
+    }
+}
+
+void operator delete(void * _pointeur, size_t, align_val_t) noexcept {
+    operator delete(_pointeur, align_val_t(0));
+}
+
+int main(int argc, char ** argv)
+{
+    if (argc == 2 && strcmp(argv[1], "--liste") == 0){
+        for (const Cas & cas : CAS){
+            printf("%s\n", cas.nom);
+        }
+        return 0;
+    }
+    for (int i = 1; i < argc; i++){
+        bool trouve = false;
+        for (const Cas & cas : CAS){
+            trouve = trouve || strcmp(argv[i], cas.nom) == 0;
+        }
+        if (!trouve){
+            fprintf(stderr, "Cas inconnu: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    for (const Cas & cas : CAS){
+        bool choisi = argc == 1;
+        for (int i = 1; i < argc; i++){
+            choisi = choisi || strcmp(argv[i], cas.nom) == 0;
+        }
+        if (!choisi){
+            continue;
+        }
+        const int echecsAvant = nombreEchecs;
+        try {
+            cas.fonction();
+        }
+        catch (const exception & _erreur){
+            fprintf(stderr, "%s: exception inattendue: %s\n", cas.nom, _erreur.what());
+            nombreEchecs++;
+        }
+        printf("%s: %s\n", cas.nom, nombreEchecs == echecsAvant ? "ok" : "CHEC");
+    }
+    return nombreEchecs == 0 ? 0 : 1;
+}